@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "model/s21_graph.h"
+#include "model/shortest_path/all_pairs_shortest_paths.h"
+#include "model/shortest_path/floyd_warshall.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr uint64_t kInfinity = MinPlusKernel<uint64_t>::kInfinity;
+
+template <class Distance = uint64_t>
+std::vector<Distance> MakeDistances(size_t size) {
+  std::mt19937 gen(size);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<Distance> weight(1, 100);
+  std::vector<Distance> distances(size * size,
+                                  MinPlusKernel<Distance>::kInfinity);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < size; ++j) {
+      if (i == j) {
+        distances[i * size + j] = 0;
+      } else if (coin(gen) < 0.3) {
+        distances[i * size + j] = weight(gen);
+      }
+    }
+  }
+  return distances;
+}
+
+// The unblocked, branchy triple loop the library used to run.
+void BM_FloydWarshallNaive(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const std::vector<uint64_t> input = MakeDistances(n);
+  for (auto _ : state) {
+    std::vector<uint64_t> d = input;
+    for (size_t k = 0; k < n; ++k) {
+      for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+          uint64_t weight = d[i * n + k] + d[k * n + j];
+          if (d[i * n + k] != kInfinity && d[k * n + j] != kInfinity &&
+              d[i * n + j] > weight)
+            d[i * n + j] = weight;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(d.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+
+template <class Distance>
+void BM_FloydWarshallBlocked(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const size_t threads = state.range(1);
+  const SimdLevel level = static_cast<SimdLevel>(state.range(2));
+  const std::vector<Distance> input = MakeDistances<Distance>(n);
+  FloydWarshall floyd_warshall(threads, FloydWarshall::kDefaultBlockSize,
+                               level);
+  for (auto _ : state) {
+    std::vector<Distance> d = input;
+    floyd_warshall.Solve(d, n);
+    benchmark::DoNotOptimize(d.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+
+// Floyd-Warshall against per-source Dijkstra over edge densities, given in
+// tenths of a percent, to place AllPairsParams::dijkstra_max_density.
+void BM_AllPairsByDensity(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const double density = state.range(1) / 1000.0;
+  const AllPairsAlgorithm algorithm =
+      static_cast<AllPairsAlgorithm>(state.range(2));
+  std::mt19937 gen(n);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<size_t> weight(1, 100);
+  Graph graph(n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      if (i != j && coin(gen) < density) graph.SetValue(i, j, weight(gen));
+    }
+  }
+  AllPairsParams params;
+  params.algorithm = algorithm;
+  AllPairsShortestPaths solver(params);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solver.Solve(graph));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_AllPairsByDensity)
+    ->ArgsProduct({{512, 2048},
+                   {1, 10, 50, 200},
+                   {static_cast<int>(AllPairsAlgorithm::kFloydWarshall),
+                    static_cast<int>(AllPairsAlgorithm::kDijkstra)}})
+    ->ArgNames({"n", "permille", "algorithm"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_FloydWarshallNaive)
+    ->Arg(256)
+    ->Arg(512)
+    ->Arg(1024)
+    ->Unit(benchmark::kMillisecond);
+void BlockedArgs(benchmark::internal::Benchmark *bench) {
+  bench
+      ->ArgsProduct({{256, 512, 1024, 4000},
+                     {1, 2, 4, 8},
+                     {static_cast<int>(SimdLevel::kScalar),
+                      static_cast<int>(SimdLevel::kSse4),
+                      static_cast<int>(SimdLevel::kAvx2)}})
+      ->ArgNames({"n", "threads", "simd"})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(BM_FloydWarshallBlocked, uint32_t)->Apply(BlockedArgs);
+BENCHMARK_TEMPLATE(BM_FloydWarshallBlocked, uint64_t)->Apply(BlockedArgs);
+
+}  // namespace s21
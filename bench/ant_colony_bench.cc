@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include "common_bench.h"
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/ant_colony_algorithm/ant_colony_solver.h"
+
+namespace s21 {
+
+namespace {
+
+// One colony of 1000 ants in iterations of 32, over thread counts.
+void BM_AntColonyThreads(benchmark::State &state) {
+  Graph graph = MakeEuclideanGraph(state.range(0));
+  AntColonyParams params;
+  params.ants_per_iteration = 32;
+  params.thread_count = state.range(1);
+  double distance = 0;
+  for (auto _ : state) {
+    AntColony colony(graph, 1, 1000, params);
+    distance = colony.Solve().distance;
+  }
+  state.counters["distance"] = distance;
+}
+
+// Colonies of different sizes with and without 2-opt / Or-opt on the best
+// tour of every iteration: compare time and distance at equal quality.
+void BM_AntColonyLocalSearch(benchmark::State &state) {
+  Graph graph = MakeEuclideanGraph(state.range(0));
+  AntColonyParams params;
+  params.ants_per_iteration = 32;
+  params.local_search = state.range(2) != 0;
+  double distance = 0;
+  for (auto _ : state) {
+    AntColony colony(graph, 1, state.range(1), params);
+    distance = colony.Solve().distance;
+  }
+  state.counters["distance"] = distance;
+}
+
+}  // namespace
+
+BENCHMARK(BM_AntColonyLocalSearch)
+    ->ArgsProduct({{200}, {64, 256, 1000}, {0, 1}})
+    ->ArgNames({"n", "ants", "local_search"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_AntColonyThreads)
+    ->ArgsProduct({{50, 200}, {1, 2, 4, 8, 16, 32}})
+    ->ArgNames({"n", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace s21
@@ -0,0 +1,111 @@
+#include "common_bench.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::atomic<size_t> allocation_count{0};
+
+void *Allocate(size_t size, size_t alignment) {
+  ++allocation_count;
+  size = std::max<size_t>(size, 1);
+  void *pointer =
+      alignment <= alignof(std::max_align_t)
+          ? std::malloc(size)
+          : std::aligned_alloc(alignment,
+                               (size + alignment - 1) / alignment * alignment);
+  if (pointer == nullptr) throw std::bad_alloc();
+  return pointer;
+}
+
+}  // namespace
+
+// GCC sees the malloc behind operator new once these are inlined into a
+// new/delete pair and reports it as a mismatch with free.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// The array and nothrow forms call these, so every allocation is counted.
+void *operator new(size_t size) { return Allocate(size, 0); }
+
+void *operator new(size_t size, std::align_val_t alignment) {
+  return Allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, size_t) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+namespace s21 {
+
+Graph MakeEuclideanGraph(size_t size) {
+  std::mt19937 gen(size);
+  std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+  std::vector<double> x(size), y(size);
+  for (size_t i = 0; i < size; ++i) {
+    x[i] = coordinate(gen);
+    y[i] = coordinate(gen);
+  }
+  Graph graph(size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < size; ++j) {
+      if (i == j) continue;
+      double distance = std::hypot(x[i] - x[j], y[i] - y[j]);
+      graph.SetValue(i, j, std::max<size_t>(1, std::lround(distance)));
+    }
+  }
+  return graph;
+}
+
+Graph MakeRandomGraph(size_t size, size_t permille) {
+  std::mt19937 gen(size * 1000 + permille);
+  std::uniform_int_distribution<size_t> coin(0, 999);
+  std::uniform_int_distribution<size_t> weight(1, 1000);
+  Graph graph(size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = i + 1; j < size; ++j) {
+      if (coin(gen) >= permille) continue;
+      size_t value = weight(gen);
+      graph.SetValue(i, j, value);
+      graph.SetValue(j, i, value);
+    }
+  }
+  std::vector<size_t> cycle(size);
+  std::iota(cycle.begin(), cycle.end(), 0);
+  std::shuffle(cycle.begin(), cycle.end(), gen);
+  for (size_t i = 0; size > 1 && i < size; ++i) {
+    size_t from = cycle[i];
+    size_t to = cycle[(i + 1) % size];
+    if (graph.GetValue(from, to) != 0) continue;
+    size_t value = weight(gen);
+    graph.SetValue(from, to, value);
+    graph.SetValue(to, from, value);
+  }
+  return graph;
+}
+
+size_t AllocationCount() { return allocation_count.load(); }
+
+void SetAllocationsPerOp(benchmark::State &state, size_t before) {
+  state.counters["allocs_per_op"] =
+      benchmark::Counter(static_cast<double>(AllocationCount() - before),
+                         benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace s21
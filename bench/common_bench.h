@@ -0,0 +1,32 @@
+#ifndef SIMPLE_NAVIGATOR_BENCH_COMMON_BENCH_H_
+#define SIMPLE_NAVIGATOR_BENCH_COMMON_BENCH_H_
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "model/s21_graph.h"
+
+namespace s21 {
+
+// Complete graph over random points in a square, rounded Euclidean weights.
+Graph MakeEuclideanGraph(size_t size);
+
+// Random undirected graph where each pair of vertices is joined with
+// probability permille / 1000, weights 1..1000, on top of a random
+// Hamiltonian cycle, so every vertex is reachable and a tour exists at any
+// density.
+Graph MakeRandomGraph(size_t size, size_t permille);
+
+// Heap allocations made through the global operator new so far, by any
+// thread. Counting them costs an atomic increment per allocation.
+size_t AllocationCount();
+
+// Sets the allocs_per_op counter to the allocations made since `before`,
+// a value of AllocationCount() taken just before the benchmark loop,
+// averaged over its iterations.
+void SetAllocationsPerOp(benchmark::State &state, size_t before);
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_BENCH_COMMON_BENCH_H_
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common_bench.h"
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+
+namespace s21 {
+
+// Every GraphAlgorithms entry point but the TSP solvers, on random graphs
+// over size and density (arcs per thousand pairs), through both the matrix
+// and the CSR overloads where there are two. items_per_second counts the
+// arcs of the graph, so runs of different sizes and densities compare;
+// allocs_per_op is what one call allocates.
+
+namespace {
+
+enum class Layout { kMatrix, kCsr };
+
+enum class Entry { kBreadthFirst, kDepthFirst, kShortestPath };
+
+size_t CountArcs(const Graph &graph) {
+  size_t arcs = 0;
+  for (size_t i = 0; i < graph.GetSize(); ++i) {
+    for (size_t weight : graph.GetRow(i)) arcs += weight != 0;
+  }
+  return arcs;
+}
+
+template <class AnyGraph>
+size_t Run(GraphAlgorithms &algorithms, AnyGraph &graph, Entry entry,
+           PriorityQueueType queue) {
+  switch (entry) {
+    case Entry::kBreadthFirst:
+      return algorithms.BreadthFirstSearch(graph, 1).size();
+    case Entry::kDepthFirst:
+      return algorithms.DepthFirstSearch(graph, 1).size();
+    default:
+      return algorithms.GetShortestPathBetweenVertices(graph, 1,
+                                                       graph.GetSize(), queue);
+  }
+}
+
+// Traversals and single-pair Dijkstra from the first vertex to the last,
+// with the queue the last argument picks.
+void BM_SingleSource(benchmark::State &state) {
+  Graph graph = MakeRandomGraph(state.range(0), state.range(1));
+  const CsrGraph csr(graph);
+  const Layout layout = static_cast<Layout>(state.range(2));
+  const Entry entry = static_cast<Entry>(state.range(3));
+  const PriorityQueueType queue = static_cast<PriorityQueueType>(
+      entry == Entry::kShortestPath ? state.range(4) : 0);
+  GraphAlgorithms algorithms;
+  const size_t before = AllocationCount();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        layout == Layout::kMatrix ? Run(algorithms, graph, entry, queue)
+                                  : Run(algorithms, csr, entry, queue));
+  }
+  SetAllocationsPerOp(state, before);
+  state.SetItemsProcessed(state.iterations() * csr.GetEdgeCount());
+}
+
+void BM_AllPairs(benchmark::State &state) {
+  Graph graph = MakeRandomGraph(state.range(0), state.range(1));
+  const CsrGraph csr(graph);
+  AllPairsParams params;
+  params.algorithm = static_cast<AllPairsAlgorithm>(state.range(3));
+  GraphAlgorithms algorithms;
+  const size_t before = AllocationCount();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        state.range(2) == static_cast<int>(Layout::kMatrix)
+            ? algorithms.GetShortestPathsBetweenAllVertices(graph, params)
+            : algorithms.GetShortestPathsBetweenAllVertices(csr, params));
+  }
+  SetAllocationsPerOp(state, before);
+  state.SetItemsProcessed(state.iterations() * CountArcs(graph));
+}
+
+// The edge list entry point; the matrix one adds an n x n copy on top.
+void BM_SpanningTree(benchmark::State &state) {
+  Graph graph = MakeRandomGraph(state.range(0), state.range(1));
+  const CsrGraph csr(graph);
+  const SpanningTreeAlgorithm algorithm =
+      static_cast<SpanningTreeAlgorithm>(state.range(3));
+  GraphAlgorithms algorithms;
+  const size_t before = AllocationCount();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        state.range(2) == static_cast<int>(Layout::kMatrix)
+            ? algorithms.GetLeastSpanningTreeEdges(graph, algorithm)
+            : algorithms.GetLeastSpanningTreeEdges(csr, algorithm));
+  }
+  SetAllocationsPerOp(state, before);
+  state.SetItemsProcessed(state.iterations() * csr.GetEdgeCount());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SingleSource)
+    ->ArgsProduct({{1000, 4000},
+                   {5, 50, 500},
+                   {static_cast<int>(Layout::kMatrix),
+                    static_cast<int>(Layout::kCsr)},
+                   {static_cast<int>(Entry::kBreadthFirst),
+                    static_cast<int>(Entry::kDepthFirst)},
+                   {0}})
+    ->ArgsProduct({{1000, 4000},
+                   {5, 50, 500},
+                   {static_cast<int>(Layout::kMatrix),
+                    static_cast<int>(Layout::kCsr)},
+                   {static_cast<int>(Entry::kShortestPath)},
+                   {static_cast<int>(PriorityQueueType::kDaryHeap),
+                    static_cast<int>(PriorityQueueType::kRadixHeap)}})
+    ->ArgNames({"n", "permille", "csr", "entry", "queue"})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AllPairs)
+    ->ArgsProduct({{256, 1024},
+                   {5, 50, 500},
+                   {static_cast<int>(Layout::kMatrix),
+                    static_cast<int>(Layout::kCsr)},
+                   {static_cast<int>(AllPairsAlgorithm::kFloydWarshall),
+                    static_cast<int>(AllPairsAlgorithm::kDijkstra)}})
+    ->ArgNames({"n", "permille", "csr", "algorithm"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_SpanningTree)
+    ->ArgsProduct({{1000, 4000},
+                   {5, 50, 500},
+                   {static_cast<int>(Layout::kMatrix),
+                    static_cast<int>(Layout::kCsr)},
+                   {static_cast<int>(SpanningTreeAlgorithm::kPrim),
+                    static_cast<int>(SpanningTreeAlgorithm::kKruskal),
+                    static_cast<int>(SpanningTreeAlgorithm::kBoruvka)}})
+    ->ArgNames({"n", "permille", "csr", "algorithm"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace s21
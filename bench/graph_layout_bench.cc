@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "model/s21_graph.h"
+
+namespace s21 {
+
+// Compares the flat row-major storage behind Graph with the vector-of-vectors
+// layout it replaced, on the access patterns GraphAlgorithms relies on.
+
+namespace {
+
+using NestedMatrix = std::vector<std::vector<size_t>>;
+
+constexpr size_t kMaxWeight = 100;
+
+NestedMatrix MakeNestedMatrix(size_t size) {
+  std::mt19937 gen(size);
+  std::uniform_int_distribution<size_t> dist(0, kMaxWeight);
+  NestedMatrix matrix(size, std::vector<size_t>(size));
+  for (auto &row : matrix) {
+    for (auto &value : row) value = dist(gen);
+  }
+  return matrix;
+}
+
+Graph MakeFlatGraph(size_t size) {
+  std::mt19937 gen(size);
+  std::uniform_int_distribution<size_t> dist(0, kMaxWeight);
+  Graph graph(size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < size; ++j) graph.SetValue(i, j, dist(gen));
+  }
+  return graph;
+}
+
+void SetMatrixCounters(benchmark::State &state, size_t size) {
+  state.SetItemsProcessed(state.iterations() * size * size);
+  state.SetBytesProcessed(state.iterations() * size * size * sizeof(size_t));
+}
+
+void BM_NestedLayoutScan(benchmark::State &state) {
+  const size_t size = state.range(0);
+  NestedMatrix matrix = MakeNestedMatrix(size);
+  for (auto _ : state) {
+    size_t sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = 0; j < size; ++j) sum += matrix[i][j];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  SetMatrixCounters(state, size);
+}
+
+void BM_FlatLayoutScan(benchmark::State &state) {
+  const size_t size = state.range(0);
+  Graph graph = MakeFlatGraph(size);
+  for (auto _ : state) {
+    size_t sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t value : graph.GetRow(i)) sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  SetMatrixCounters(state, size);
+}
+
+// One pivot step of Floyd-Warshall: every row is relaxed through the pivot
+// row, which is the inner loop of GetShortestPathsBetweenAllVertices.
+void BM_NestedLayoutRelaxation(benchmark::State &state) {
+  const size_t size = state.range(0);
+  NestedMatrix matrix = MakeNestedMatrix(size);
+  size_t pivot = 0;
+  for (auto _ : state) {
+    const std::vector<size_t> &pivot_row = matrix[pivot];
+    for (size_t i = 0; i < size; ++i) {
+      size_t to_pivot = matrix[i][pivot];
+      for (size_t j = 0; j < size; ++j) {
+        if (matrix[i][j] > to_pivot + pivot_row[j]) {
+          matrix[i][j] = to_pivot + pivot_row[j];
+        }
+      }
+    }
+    pivot = (pivot + 1) % size;
+    benchmark::ClobberMemory();
+  }
+  SetMatrixCounters(state, size);
+}
+
+void BM_FlatLayoutRelaxation(benchmark::State &state) {
+  const size_t size = state.range(0);
+  Graph graph = MakeFlatGraph(size);
+  Graph::Row data = graph.GetFlatData();
+  std::vector<size_t> matrix(data.begin(), data.end());
+  size_t pivot = 0;
+  for (auto _ : state) {
+    const size_t *pivot_row = matrix.data() + pivot * size;
+    for (size_t i = 0; i < size; ++i) {
+      size_t *row = matrix.data() + i * size;
+      size_t to_pivot = row[pivot];
+      for (size_t j = 0; j < size; ++j) {
+        if (row[j] > to_pivot + pivot_row[j]) row[j] = to_pivot + pivot_row[j];
+      }
+    }
+    pivot = (pivot + 1) % size;
+    benchmark::ClobberMemory();
+  }
+  SetMatrixCounters(state, size);
+}
+
+void LayoutSizes(benchmark::internal::Benchmark *bench) {
+  for (int64_t size : {1000, 2000, 4000, 10000}) bench->Arg(size);
+  bench->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK(BM_NestedLayoutScan)->Apply(LayoutSizes);
+BENCHMARK(BM_FlatLayoutScan)->Apply(LayoutSizes);
+BENCHMARK(BM_NestedLayoutRelaxation)->Apply(LayoutSizes);
+BENCHMARK(BM_FlatLayoutRelaxation)->Apply(LayoutSizes);
+
+}  // namespace s21
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "common_bench.h"
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/common/local_search.h"
+
+namespace s21 {
+
+namespace {
+
+// From a random tour to a 2-opt / Or-opt local optimum; the counter is the
+// tour length as a share of the random one.
+void BM_LocalSearchRandomTour(benchmark::State &state) {
+  Graph graph = MakeEuclideanGraph(state.range(0));
+  LocalSearchParams params;
+  params.neighbour_count = state.range(1);
+  LocalSearch local_search(graph, params);
+  std::mt19937 gen(1);
+  TsmResult start;
+  start.vertices.resize(graph.GetSize());
+  std::iota(start.vertices.begin(), start.vertices.end(), 0);
+  std::shuffle(start.vertices.begin(), start.vertices.end(), gen);
+  start.vertices.push_back(start.vertices.front());
+  start.distance = 0;
+  for (size_t i = 0; i + 1 < start.vertices.size(); ++i) {
+    start.distance += graph.GetValue(start.vertices[i], start.vertices[i + 1]);
+  }
+
+  TsmResult tour;
+  for (auto _ : state) {
+    state.PauseTiming();
+    tour = start;
+    state.ResumeTiming();
+    local_search.Improve(tour);
+  }
+  state.counters["ratio"] = tour.distance / start.distance;
+}
+
+}  // namespace
+
+BENCHMARK(BM_LocalSearchRandomTour)
+    ->ArgsProduct({{1000, 4000}, {5, 10, 20}})
+    ->ArgNames({"n", "neighbours"})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace s21
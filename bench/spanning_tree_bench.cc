@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "model/s21_csr_graph.h"
+#include "model/spanning_tree/minimum_spanning_tree.h"
+
+namespace s21 {
+
+namespace {
+
+// Random undirected graph with `degree` arcs per vertex on average, stored
+// in both directions like the adjacency matrices the program loads.
+CsrGraph MakeSparseGraph(size_t size, size_t degree) {
+  std::mt19937 gen(size);
+  std::uniform_int_distribution<size_t> vertex(0, size - 1);
+  std::uniform_int_distribution<size_t> weight(1, 1000);
+  std::vector<Edge> edges;
+  edges.reserve(size * degree);
+  for (size_t i = 0; i < size * degree / 2; ++i) {
+    size_t from = vertex(gen);
+    size_t to = vertex(gen);
+    size_t value = weight(gen);
+    edges.push_back(Edge{from, to, value});
+    edges.push_back(Edge{to, from, value});
+  }
+  return CsrGraph(size, edges);
+}
+
+void BM_SpanningTreeSequential(benchmark::State &state) {
+  const CsrGraph graph = MakeSparseGraph(state.range(0), 8);
+  MinimumSpanningTree solver(
+      static_cast<SpanningTreeAlgorithm>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solver.Solve(graph));
+  }
+  state.SetItemsProcessed(state.iterations() * graph.GetEdgeCount());
+}
+
+// Boruvka over thread counts, to compare with the sequential algorithms
+// above on the same graphs.
+void BM_BoruvkaScaling(benchmark::State &state) {
+  const CsrGraph graph = MakeSparseGraph(state.range(0), 8);
+  MinimumSpanningTree solver(SpanningTreeAlgorithm::kBoruvka, state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solver.Solve(graph));
+  }
+  state.SetItemsProcessed(state.iterations() * graph.GetEdgeCount());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SpanningTreeSequential)
+    ->ArgsProduct({{100000, 1000000},
+                   {static_cast<int>(SpanningTreeAlgorithm::kPrim),
+                    static_cast<int>(SpanningTreeAlgorithm::kKruskal)}})
+    ->ArgNames({"n", "algorithm"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_BoruvkaScaling)
+    ->ArgsProduct({{100000, 1000000}, {1, 2, 4, 8, 16, 32}})
+    ->ArgNames({"n", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace s21
@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "common_bench.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+
+namespace s21 {
+
+namespace {
+
+enum class TspSolver {
+  kAntColony,
+  kGenetic,
+  kGeneticEdgeAssembly,
+  kSimulatedAnnealing,
+  kLinKernighan
+};
+
+const char *const kSolverNames[] = {"ant_colony", "genetic", "genetic_eax",
+                                    "simulated_annealing", "lin_kernighan"};
+
+// Every solver is seeded, so runs compare tour for tour.
+constexpr uint64_t kSeed = 1;
+
+TsmResult Solve(GraphAlgorithms &algorithms, Graph &graph, TspSolver solver) {
+  switch (solver) {
+    case TspSolver::kAntColony: {
+      AntColonyParams params;
+      params.seed = kSeed;
+      return algorithms.SolveTravelingSalesmanProblem(
+          graph, PheromoneUpdateType::kAntSystem, params);
+    }
+    case TspSolver::kGenetic:
+    case TspSolver::kGeneticEdgeAssembly: {
+      GeneticParams params;
+      params.seed = kSeed;
+      if (solver == TspSolver::kGeneticEdgeAssembly) {
+        params.crossover = CrossoverType::kEdgeAssembly;
+      }
+      return algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(graph,
+                                                                      params);
+    }
+    case TspSolver::kSimulatedAnnealing: {
+      AnnealingParams params;
+      params.seed = kSeed;
+      return algorithms.SolveTravelingSalesmanProblemSimulatedAnnealing(
+          graph, params);
+    }
+    default: {
+      LinKernighanParams params;
+      params.seed = kSeed;
+      return algorithms.SolveTravelingSalesmanProblemLinKernighan(graph,
+                                                                  params);
+    }
+  }
+}
+
+// Best tour a long Lin-Kernighan run finds, computed once per graph; the
+// benchmark function is called several times per argument set.
+double ReferenceLength(Graph &graph, const std::string &name) {
+  static std::map<std::string, double> references;
+  auto found = references.find(name);
+  if (found != references.end()) return found->second;
+  LinKernighanParams params;
+  params.kicks = 10 * graph.GetSize();
+  params.seed = kSeed;
+  double length = GraphAlgorithms()
+                      .SolveTravelingSalesmanProblemLinKernighan(graph, params)
+                      .distance;
+  references.emplace(name, length);
+  return length;
+}
+
+// distance is the length of the last tour found and gap how much longer it
+// is than the reference; items_per_second counts tours.
+void RunSolver(benchmark::State &state, Graph &graph, double reference) {
+  TspSolver solver = static_cast<TspSolver>(state.range(0));
+  GraphAlgorithms algorithms;
+  double distance = 0;
+  const size_t before = AllocationCount();
+  for (auto _ : state) {
+    distance = Solve(algorithms, graph, solver).distance;
+  }
+  SetAllocationsPerOp(state, before);
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel(kSolverNames[state.range(0)]);
+  state.counters["distance"] = distance;
+  if (reference != std::numeric_limits<double>::infinity()) {
+    state.counters["gap"] = distance / reference - 1;
+  }
+}
+
+// The solvers as the program runs them, on the example graph of the
+// assets (optimum 253), on random Euclidean ones and on random graphs
+// over density, where many pairs have no arc and a tour is harder to find.
+void BM_TspSolversExample(benchmark::State &state) {
+  Graph graph;
+  graph.LoadGraphFromFile(std::string(SIMPLE_NAVIGATOR_ASSETS_DIR) +
+                          "/graph_example.txt");
+  RunSolver(state, graph, 253);
+}
+
+void BM_TspSolversEuclidean(benchmark::State &state) {
+  Graph graph = MakeEuclideanGraph(state.range(1));
+  RunSolver(state, graph,
+            ReferenceLength(graph, "euclidean/" +
+                                       std::to_string(state.range(1))));
+}
+
+void BM_TspSolversByDensity(benchmark::State &state) {
+  Graph graph = MakeRandomGraph(state.range(1), state.range(2));
+  RunSolver(state, graph,
+            ReferenceLength(graph, "random/" + std::to_string(state.range(1)) +
+                                       "/" + std::to_string(state.range(2))));
+}
+
+// Lin-Kernighan alone on instances the others take too long on.
+void BM_LinKernighanLarge(benchmark::State &state) {
+  Graph graph = MakeEuclideanGraph(state.range(0));
+  GraphAlgorithms algorithms;
+  LinKernighanParams params;
+  params.seed = kSeed;
+  double distance = 0;
+  const size_t before = AllocationCount();
+  for (auto _ : state) {
+    distance =
+        algorithms.SolveTravelingSalesmanProblemLinKernighan(graph, params)
+            .distance;
+  }
+  SetAllocationsPerOp(state, before);
+  state.counters["distance"] = distance;
+}
+
+}  // namespace
+
+BENCHMARK(BM_TspSolversExample)
+    ->DenseRange(0, 4)
+    ->ArgName("solver")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TspSolversEuclidean)
+    ->ArgsProduct({{0, 1, 2, 3, 4}, {100, 500}})
+    ->ArgNames({"solver", "n"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TspSolversByDensity)
+    ->ArgsProduct({{0, 1, 2, 3, 4}, {100, 500}, {200, 500, 1000}})
+    ->ArgNames({"solver", "n", "permille"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LinKernighanLarge)
+    ->Arg(2000)
+    ->Arg(5000)
+    ->ArgName("n")
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace s21
@@ -19,6 +19,11 @@ size_t Controller::GetShortestPathBetweenVertices(size_t vertex1,
   return algorithms_.GetShortestPathBetweenVertices(graph_, vertex1, vertex2);
 }
 
+RouteResult Controller::GetShortestRouteBetweenVertices(size_t vertex1,
+                                                        size_t vertex2) {
+  return algorithms_.GetShortestRouteBetweenVertices(graph_, vertex1, vertex2);
+}
+
 std::vector<std::vector<size_t>>
 Controller::GetShortestPathsBetweenAllVertices() {
   return algorithms_.GetShortestPathsBetweenAllVertices(graph_);
@@ -40,5 +45,9 @@ TsmResult s21::Controller::SolveTravelingSalesmanProblemSimulatedAnnealing() {
   return algorithms_.SolveTravelingSalesmanProblemSimulatedAnnealing(graph_);
 }
 
+TsmResult Controller::SolveTravelingSalesmanProblemLinKernighan() {
+  return algorithms_.SolveTravelingSalesmanProblemLinKernighan(graph_);
+}
+
 bool Controller::GraphIsEmpty() { return graph_.GraphIsEmpty(); }
 }  // namespace s21
@@ -15,11 +15,13 @@ class Controller {
   std::vector<size_t> BreadthFirstSearch(size_t start_vertex);
   std::vector<size_t> DepthFirstSearch(size_t start_vertex);
   size_t GetShortestPathBetweenVertices(size_t vertex1, size_t vertex2);
+  RouteResult GetShortestRouteBetweenVertices(size_t vertex1, size_t vertex2);
   std::vector<std::vector<size_t>> GetShortestPathsBetweenAllVertices();
   std::vector<std::vector<size_t>> GetLeastSpanningTree();
   TsmResult SolveTravelingSalesmanProblem();
   TsmResult SolveTravelingSalesmanProblemGeneticAlgorithm();
   TsmResult SolveTravelingSalesmanProblemSimulatedAnnealing();
+  TsmResult SolveTravelingSalesmanProblemLinKernighan();
   bool GraphIsEmpty();
 
  private:
@@ -0,0 +1,59 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_ALIGNED_ALLOCATOR_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_ALIGNED_ALLOCATOR_H_
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace s21 {
+
+constexpr size_t kCacheLineSize = 64;
+
+// Allocator for standard containers whose storage must start on an
+// `Alignment` boundary (a cache line by default).
+template <class T, size_t Alignment = kCacheLineSize>
+class AlignedAllocator {
+  static_assert(Alignment >= alignof(T), "Alignment is too small for type");
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "Alignment must be a power of two");
+
+ public:
+  // AlignedAllocator Member type
+  using value_type = T;
+
+  template <class U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  // AlignedAllocator Member functions
+  AlignedAllocator() noexcept = default;
+  template <class U>
+  explicit AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+  T *allocate(size_t n) {
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+  }
+
+  void deallocate(T *pointer, size_t) noexcept {
+    ::operator delete(pointer, std::align_val_t{Alignment});
+  }
+
+  template <class U>
+  bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_ALIGNED_ALLOCATOR_H_
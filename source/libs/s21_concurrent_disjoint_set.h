@@ -0,0 +1,99 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_CONCURRENT_DISJOINT_SET_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_CONCURRENT_DISJOINT_SET_H_
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Lock-free union-find over the elements 0..size-1 that any number of
+// threads may use at once. Find halves paths with compare-and-swap and
+// Union hangs the larger root under the smaller one, so every set ends up
+// rooted at its smallest element whatever order the threads run in. Reset
+// and Size are not thread-safe.
+class ConcurrentDisjointSet {
+ public:
+  // ConcurrentDisjointSet Member type
+  using SizeType = size_t;
+
+  // ConcurrentDisjointSet Member functions
+  ConcurrentDisjointSet() = default;
+  explicit ConcurrentDisjointSet(SizeType size) { Reset(size); }
+
+  ConcurrentDisjointSet(const ConcurrentDisjointSet &) = delete;
+  ConcurrentDisjointSet &operator=(const ConcurrentDisjointSet &) = delete;
+
+  // Puts every element back into a set of its own.
+  void Reset(SizeType size) {
+    if (size != parent_.size()) parent_ = std::vector<Slot>(size);
+    for (SizeType i = 0; i < size; ++i) {
+      parent_[i].store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // ConcurrentDisjointSet Lookup
+  SizeType Find(SizeType element) {
+    CheckElement(element);
+    while (true) {
+      SizeType parent = parent_[element].load(std::memory_order_acquire);
+      if (parent == element) return element;
+      SizeType grandparent = parent_[parent].load(std::memory_order_acquire);
+      if (grandparent != parent) {
+        // Losing this race only means another thread shortened it first.
+        parent_[element].compare_exchange_weak(parent, grandparent,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed);
+      }
+      element = grandparent;
+    }
+  }
+
+  bool Connected(SizeType first, SizeType second) {
+    while (true) {
+      first = Find(first);
+      second = Find(second);
+      if (first == second) return true;
+      // Still a root, so no union has moved `first` in between.
+      if (parent_[first].load(std::memory_order_acquire) == first) {
+        return false;
+      }
+    }
+  }
+
+  // ConcurrentDisjointSet Capacity
+  SizeType Size() const noexcept { return parent_.size(); }
+
+  // ConcurrentDisjointSet Modifiers
+  // Merges the sets of both elements; false when they already were one.
+  bool Union(SizeType first, SizeType second) {
+    while (true) {
+      first = Find(first);
+      second = Find(second);
+      if (first == second) return false;
+      if (first > second) std::swap(first, second);
+      SizeType expected = second;
+      if (parent_[second].compare_exchange_strong(expected, first,
+                                                  std::memory_order_acq_rel)) {
+        return true;
+      }
+    }
+  }
+
+ private:
+  using Slot = std::atomic<SizeType>;
+
+  std::vector<Slot> parent_;
+
+  void CheckElement(SizeType element) const {
+    if (element >= parent_.size()) {
+      throw std::out_of_range("Disjoint set element is out of range");
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_CONCURRENT_DISJOINT_SET_H_
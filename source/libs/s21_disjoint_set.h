@@ -0,0 +1,79 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_DISJOINT_SET_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_DISJOINT_SET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Union-find over the elements 0..size-1 with path compression and union by
+// rank, so any sequence of operations runs in near-constant amortized time.
+class DisjointSet {
+ public:
+  // DisjointSet Member type
+  using SizeType = size_t;
+
+  // DisjointSet Member functions
+  DisjointSet() = default;
+  explicit DisjointSet(SizeType size) { Reset(size); }
+
+  // Puts every element back into a set of its own.
+  void Reset(SizeType size) {
+    parent_.resize(size);
+    std::iota(parent_.begin(), parent_.end(), SizeType{0});
+    rank_.assign(size, 0);
+    set_count_ = size;
+  }
+
+  // DisjointSet Lookup
+  SizeType Find(SizeType element) {
+    CheckElement(element);
+    SizeType root = element;
+    while (parent_[root] != root) root = parent_[root];
+    while (parent_[element] != root) {
+      element = std::exchange(parent_[element], root);
+    }
+    return root;
+  }
+
+  bool Connected(SizeType first, SizeType second) {
+    return Find(first) == Find(second);
+  }
+
+  // DisjointSet Capacity
+  SizeType Size() const noexcept { return parent_.size(); }
+  SizeType SetCount() const noexcept { return set_count_; }
+
+  // DisjointSet Modifiers
+  // Merges the sets of both elements; false when they already were one.
+  bool Union(SizeType first, SizeType second) {
+    first = Find(first);
+    second = Find(second);
+    if (first == second) return false;
+    if (rank_[first] < rank_[second]) std::swap(first, second);
+    parent_[second] = first;
+    if (rank_[first] == rank_[second]) ++rank_[first];
+    --set_count_;
+    return true;
+  }
+
+ private:
+  std::vector<SizeType> parent_;
+  // Upper bound of the tree height, below 64 for any addressable size.
+  std::vector<uint8_t> rank_;
+  SizeType set_count_ = 0;
+
+  void CheckElement(SizeType element) const {
+    if (element >= parent_.size()) {
+      throw std::out_of_range("Disjoint set element is out of range");
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_DISJOINT_SET_H_
@@ -0,0 +1,130 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_INDEXED_HEAP_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_INDEXED_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace s21 {
+
+// d-ary min-heap over the items 0..capacity-1, each present at most once.
+// Keeps the heap position of every item so decrease-key is O(log_d n).
+template <class Key, size_t Arity = 4, class Compare = std::less<Key>>
+class IndexedHeap {
+  static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+ public:
+  // IndexedHeap Member type
+  using KeyType = Key;
+  using SizeType = size_t;
+
+  // IndexedHeap Member functions
+  IndexedHeap() = default;
+  explicit IndexedHeap(SizeType capacity) : position_(capacity, kAbsent) {}
+
+  // Forgets every item and makes room for `capacity` of them; only the
+  // items still queued are touched when the capacity does not change.
+  void Reset(SizeType capacity) {
+    if (capacity == position_.size()) {
+      for (const Node &node : nodes_) position_[node.item] = kAbsent;
+    } else {
+      position_.assign(capacity, kAbsent);
+    }
+    nodes_.clear();
+  }
+
+  // IndexedHeap Element access
+  SizeType Top() const { return nodes_.front().item; }
+  const Key &TopKey() const { return nodes_.front().key; }
+  const Key &GetKey(SizeType item) const { return nodes_[position_[item]].key; }
+
+  // IndexedHeap Capacity
+  bool Empty() const noexcept { return nodes_.empty(); }
+  SizeType Size() const noexcept { return nodes_.size(); }
+  SizeType Capacity() const noexcept { return position_.size(); }
+  bool Contains(SizeType item) const { return position_[item] != kAbsent; }
+
+  // IndexedHeap Modifiers
+  // Inserts `item` or lowers its key; a larger key for a queued item is
+  // ignored, which is exactly the relaxation step of Dijkstra and Prim.
+  void Push(SizeType item, const Key &key) {
+    if (item >= position_.size()) {
+      throw std::out_of_range("Heap item is out of range");
+    }
+    if (Contains(item)) {
+      SizeType pos = position_[item];
+      if (compare_(key, nodes_[pos].key)) {
+        nodes_[pos].key = key;
+        SiftUp(pos);
+      }
+      return;
+    }
+    nodes_.push_back(Node{key, item});
+    position_[item] = nodes_.size() - 1;
+    SiftUp(nodes_.size() - 1);
+  }
+
+  void Pop() {
+    position_[nodes_.front().item] = kAbsent;
+    if (nodes_.size() > 1) {
+      nodes_.front() = nodes_.back();
+      position_[nodes_.front().item] = 0;
+      nodes_.pop_back();
+      SiftDown(0);
+    } else {
+      nodes_.pop_back();
+    }
+  }
+
+ private:
+  static constexpr SizeType kAbsent = std::numeric_limits<SizeType>::max();
+
+  struct Node {
+    Key key;
+    SizeType item;
+  };
+
+  std::vector<Node> nodes_;
+  std::vector<SizeType> position_;
+  Compare compare_{};
+
+  void SiftUp(SizeType pos) {
+    Node node = nodes_[pos];
+    while (pos > 0) {
+      SizeType parent = (pos - 1) / Arity;
+      if (!compare_(node.key, nodes_[parent].key)) break;
+      nodes_[pos] = nodes_[parent];
+      position_[nodes_[pos].item] = pos;
+      pos = parent;
+    }
+    nodes_[pos] = node;
+    position_[node.item] = pos;
+  }
+
+  void SiftDown(SizeType pos) {
+    Node node = nodes_[pos];
+    const SizeType size = nodes_.size();
+    while (true) {
+      SizeType first_child = pos * Arity + 1;
+      if (first_child >= size) break;
+      SizeType last_child =
+          first_child + Arity < size ? first_child + Arity : size;
+      SizeType best = first_child;
+      for (SizeType child = first_child + 1; child < last_child; ++child) {
+        if (compare_(nodes_[child].key, nodes_[best].key)) best = child;
+      }
+      if (!compare_(nodes_[best].key, node.key)) break;
+      nodes_[pos] = nodes_[best];
+      position_[nodes_[pos].item] = pos;
+      pos = best;
+    }
+    nodes_[pos] = node;
+    position_[node.item] = pos;
+  }
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_INDEXED_HEAP_H_
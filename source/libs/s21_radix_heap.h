@@ -0,0 +1,91 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_RADIX_HEAP_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_RADIX_HEAP_H_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Monotone priority queue for unsigned integer keys: a pushed key must not
+// be smaller than the last popped one. Items sit in buckets by the highest
+// bit in which their key differs from that last key, so every item moves
+// between buckets at most digits-of-size_t times.
+template <class Value>
+class RadixHeap {
+ public:
+  // RadixHeap Member type
+  using KeyType = size_t;
+  using ValueType = std::pair<KeyType, Value>;
+  using SizeType = size_t;
+
+  // RadixHeap Capacity
+  bool Empty() const noexcept { return size_ == 0; }
+  SizeType Size() const noexcept { return size_; }
+
+  // RadixHeap Element access
+  // Moves the smallest key into bucket 0 if needed; the heap must not be
+  // empty.
+  const ValueType &Top() {
+    Settle();
+    return buckets_[0].back();
+  }
+
+  // RadixHeap Modifiers
+  void Push(KeyType key, const Value &value) {
+    if (key < last_) {
+      throw std::invalid_argument("Radix heap keys must be monotone");
+    }
+    buckets_[BucketIndex(key ^ last_)].emplace_back(key, value);
+    ++size_;
+  }
+
+  void Pop() {
+    Settle();
+    buckets_[0].pop_back();
+    --size_;
+  }
+
+  void Clear() {
+    for (auto &bucket : buckets_) bucket.clear();
+    last_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  static constexpr SizeType kBucketCount =
+      std::numeric_limits<KeyType>::digits + 1;
+
+  std::array<std::vector<ValueType>, kBucketCount> buckets_{};
+  KeyType last_ = 0;
+  SizeType size_ = 0;
+
+  static SizeType BucketIndex(KeyType diff) {
+    return diff == 0 ? 0
+                     : std::numeric_limits<unsigned long long>::digits -
+                           static_cast<SizeType>(__builtin_clzll(diff));
+  }
+
+  void Settle() {
+    if (!buckets_[0].empty()) return;
+    SizeType index = 1;
+    while (buckets_[index].empty()) ++index;
+    std::vector<ValueType> &bucket = buckets_[index];
+    KeyType min_key = bucket.front().first;
+    for (const ValueType &item : bucket) {
+      if (item.first < min_key) min_key = item.first;
+    }
+    last_ = min_key;
+    for (ValueType &item : bucket) {
+      buckets_[BucketIndex(item.first ^ last_)].push_back(std::move(item));
+    }
+    bucket.clear();
+  }
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_RADIX_HEAP_H_
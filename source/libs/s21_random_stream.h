@@ -0,0 +1,97 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_RANDOM_STREAM_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_RANDOM_STREAM_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace s21 {
+
+// Counter-based random numbers, Philox4x32-10: the n-th block of a stream
+// is ten rounds of a keyed bijection applied to the counter (n, stream),
+// so a stream is just a key and two counters. Any number of independent
+// streams come from one seed without generating anything first, and work
+// split between threads draws the same numbers however it is scheduled as
+// long as every piece of work has a stream of its own. Meets the standard
+// UniformRandomBitGenerator requirements.
+class RandomStream {
+ public:
+  using result_type = uint32_t;
+
+  explicit RandomStream(uint64_t seed = 0, uint64_t stream = 0)
+      : key_{Low(seed), High(seed)},
+        counter_{0, 0, Low(stream), High(stream)} {}
+
+  // Seed for runs nobody asked to reproduce.
+  static uint64_t RandomSeed() {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) | device();
+  }
+
+  static constexpr result_type min() noexcept { return 0; }
+  static constexpr result_type max() noexcept {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    if (used_ == block_.size()) {
+      block_ = Encrypt(key_, counter_);
+      if (++counter_[0] == 0) ++counter_[1];
+      used_ = 0;
+    }
+    return block_[used_++];
+  }
+
+  // Stream number `index` of this one's own family: independent of this
+  // stream, of its other children and of every stream RandomStream(seed,
+  // n) gives, and the same whatever was drawn from this one so far. Lets
+  // a stream handed to a part of a solver be split further inside it.
+  RandomStream Split(uint64_t index) const {
+    Key key{key_[0] ^ kSplitKey[0], key_[1] ^ kSplitKey[1]};
+    Block child =
+        Encrypt(key, {Low(index), High(index), counter_[2], counter_[3]});
+    RandomStream stream;
+    stream.key_ = {child[0], child[1]};
+    stream.counter_ = {0, 0, child[2], child[3]};
+    return stream;
+  }
+
+ private:
+  using Key = std::array<uint32_t, 2>;
+  using Block = std::array<uint32_t, 4>;
+
+  static constexpr uint32_t kMultiplier0 = 0xD2511F53;
+  static constexpr uint32_t kMultiplier1 = 0xCD9E8D57;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85;
+  static constexpr Key kSplitKey{0x243F6A88, 0x85A308D3};
+
+  Key key_;
+  // Block number in the first two words, stream number in the last two.
+  Block counter_;
+  Block block_{};
+  size_t used_{block_.size()};
+
+  static uint32_t Low(uint64_t value) { return static_cast<uint32_t>(value); }
+  static uint32_t High(uint64_t value) {
+    return static_cast<uint32_t>(value >> 32);
+  }
+
+  static Block Encrypt(Key key, Block counter) {
+    for (int round = 0; round < 10; ++round) {
+      uint64_t product0 = static_cast<uint64_t>(kMultiplier0) * counter[0];
+      uint64_t product1 = static_cast<uint64_t>(kMultiplier1) * counter[2];
+      counter = {High(product1) ^ counter[1] ^ key[0], Low(product1),
+                 High(product0) ^ counter[3] ^ key[1], Low(product0)};
+      key[0] += kWeyl0;
+      key[1] += kWeyl1;
+    }
+    return counter;
+  }
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_RANDOM_STREAM_H_
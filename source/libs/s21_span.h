@@ -0,0 +1,45 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_SPAN_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_SPAN_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// Non-owning view over a contiguous sequence, a C++17 stand-in for std::span.
+template <class T>
+class Span {
+ public:
+  // Span Member type
+  using ValueType = T;
+  using Pointer = T *;
+  using Reference = T &;
+  using SizeType = size_t;
+  using Iterator = T *;
+
+  // Span Member functions
+  constexpr Span() noexcept = default;
+  constexpr Span(Pointer data, SizeType size) noexcept
+      : data_(data), size_(size) {}
+
+  // Span Element access
+  constexpr Reference operator[](SizeType pos) const noexcept {
+    return data_[pos];
+  }
+  constexpr Pointer Data() const noexcept { return data_; }
+
+  // Span Iterators
+  constexpr Iterator begin() const noexcept { return data_; }
+  constexpr Iterator end() const noexcept { return data_ + size_; }
+
+  // Span Capacity
+  constexpr SizeType Size() const noexcept { return size_; }
+  constexpr bool Empty() const noexcept { return size_ == 0; }
+
+ private:
+  Pointer data_ = nullptr;
+  SizeType size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_SPAN_H_
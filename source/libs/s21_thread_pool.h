@@ -0,0 +1,123 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_THREAD_POOL_H_
+#define SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+// Fixed set of worker threads for fork-join loops. The calling thread takes
+// part in every loop, so a pool of N threads starts N - 1 workers and a pool
+// of one runs everything inline. ParallelFor must not be called from inside
+// one of its own tasks.
+class ThreadPool {
+ public:
+  // ThreadPool Member functions
+  // Zero threads means one per hardware thread.
+  explicit ThreadPool(size_t thread_count = 0)
+      : thread_count_(ResolveThreadCount(thread_count)) {
+    workers_.reserve(thread_count_ - 1);
+    for (size_t i = 1; i < thread_count_; ++i) {
+      workers_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+  }
+
+  static size_t ResolveThreadCount(size_t thread_count) {
+    if (thread_count != 0) return thread_count;
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+
+  size_t GetThreadCount() const noexcept { return thread_count_; }
+
+  // Calls task(index) for every index in [0, count) and returns when all of
+  // them are done. The first exception thrown by a task is rethrown here.
+  template <class Task>
+  void ParallelFor(size_t count, Task &&task) {
+    if (count == 0) return;
+    if (workers_.empty() || count == 1) {
+      for (size_t i = 0; i < count; ++i) task(i);
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = [&task](size_t index) { task(index); };
+      job_size_ = count;
+      next_index_.store(0);
+      busy_workers_ = workers_.size();
+      error_ = nullptr;
+      ++generation_;
+    }
+    wake_.notify_all();
+    RunJob();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return busy_workers_ == 0; });
+    job_ = nullptr;
+    if (error_) std::rethrow_exception(error_);
+  }
+
+ private:
+  size_t thread_count_;
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  std::function<void(size_t)> job_;
+  size_t job_size_ = 0;
+  std::atomic<size_t> next_index_{0};
+  size_t busy_workers_ = 0;
+  size_t generation_ = 0;
+  bool stop_ = false;
+  std::exception_ptr error_;
+
+  void WorkerLoop() {
+    size_t seen_generation = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock,
+                   [&] { return stop_ || generation_ != seen_generation; });
+        if (stop_) return;
+        seen_generation = generation_;
+      }
+      RunJob();
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--busy_workers_ == 0) done_.notify_one();
+    }
+  }
+
+  void RunJob() {
+    size_t index;
+    while ((index = next_index_.fetch_add(1)) < job_size_) {
+      try {
+        job_(index);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) error_ = std::current_exception();
+        next_index_.store(job_size_);
+      }
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_LIBS_S21_THREAD_POOL_H_
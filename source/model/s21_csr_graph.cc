@@ -0,0 +1,103 @@
+#include "s21_csr_graph.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace s21 {
+
+CsrGraph::CsrGraph(const Graph &graph)
+    : offsets_(graph.GetSize() + 1, 0), size_(graph.GetSize()) {
+  for (size_t from = 0; from < size_; ++from) {
+    for (Arc arc : graph.GetArcs(from)) {
+      targets_.push_back(arc.to);
+      weights_.push_back(arc.weight);
+    }
+    offsets_[from + 1] = targets_.size();
+  }
+}
+
+CsrGraph::CsrGraph(size_t size, const std::vector<Edge> &edges)
+    : offsets_(size + 1, 0),
+      targets_(edges.size()),
+      weights_(edges.size()),
+      size_(size) {
+  for (const Edge &edge : edges) {
+    if (edge.from >= size_ || edge.to >= size_) {
+      throw std::out_of_range("Edge vertex is out of range");
+    }
+    if (edge.weight == 0) {
+      throw std::invalid_argument("Edge weight must be positive");
+    }
+    ++offsets_[edge.from + 1];
+  }
+  std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+  std::vector<size_t> position(offsets_.begin(), offsets_.end() - 1);
+  std::vector<size_t> order(edges.size());
+  for (size_t i = 0; i < edges.size(); ++i) {
+    order[position[edges[i].from]++] = i;
+  }
+  for (size_t from = 0; from < size_; ++from) {
+    std::stable_sort(order.begin() + offsets_[from],
+                     order.begin() + offsets_[from + 1],
+                     [&edges](size_t lhs, size_t rhs) {
+                       return edges[lhs].to < edges[rhs].to;
+                     });
+  }
+  for (size_t i = 0; i < order.size(); ++i) {
+    targets_[i] = edges[order[i]].to;
+    weights_[i] = edges[order[i]].weight;
+  }
+}
+
+CsrGraph::ArcRange CsrGraph::GetArcs(size_t from) const {
+  CheckVertex(from);
+  return ArcRange(
+      ArcIterator(targets_.data() + offsets_[from],
+                  weights_.data() + offsets_[from]),
+      ArcIterator(targets_.data() + offsets_[from + 1],
+                  weights_.data() + offsets_[from + 1]));
+}
+
+Span<const size_t> CsrGraph::GetTargets(size_t from) const {
+  CheckVertex(from);
+  return Span<const size_t>(targets_.data() + offsets_[from], GetDegree(from));
+}
+
+Span<const size_t> CsrGraph::GetWeights(size_t from) const {
+  CheckVertex(from);
+  return Span<const size_t>(weights_.data() + offsets_[from], GetDegree(from));
+}
+
+size_t CsrGraph::GetDegree(size_t from) const {
+  CheckVertex(from);
+  return offsets_[from + 1] - offsets_[from];
+}
+
+size_t CsrGraph::GetSize() const { return size_; }
+
+size_t CsrGraph::GetEdgeCount() const { return targets_.size(); }
+
+bool CsrGraph::GraphIsEmpty() const { return size_ == 0; }
+
+Graph CsrGraph::ToGraph() const {
+  Graph graph(size_);
+  for (size_t from = 0; from < size_; ++from) {
+    for (Arc arc : GetArcs(from)) {
+      size_t current = graph.GetValue(from, arc.to);
+      if (current == 0 || arc.weight < current) {
+        graph.SetValue(from, arc.to, arc.weight);
+      }
+    }
+  }
+  return graph;
+}
+
+void CsrGraph::CheckVertex(size_t vertex) const {
+  if (vertex >= size_) {
+    throw std::out_of_range("Vertex index is out of range");
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,76 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_S21_CSR_GRAPH_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_S21_CSR_GRAPH_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "libs/s21_span.h"
+#include "s21_graph.h"
+
+namespace s21 {
+
+// Compressed sparse row graph: the arcs of vertex v are
+// targets_[offsets_[v] .. offsets_[v + 1]) with matching weights_, sorted by
+// target. Memory and traversal cost are O(V + E) instead of O(V^2).
+class CsrGraph {
+ public:
+  class ArcIterator {
+   public:
+    ArcIterator() = default;
+    ArcIterator(const size_t *target, const size_t *weight)
+        : target_(target), weight_(weight) {}
+
+    Arc operator*() const { return Arc{*target_, *weight_}; }
+    ArcIterator &operator++() {
+      ++target_;
+      ++weight_;
+      return *this;
+    }
+    bool operator!=(const ArcIterator &other) const {
+      return target_ != other.target_;
+    }
+    bool operator==(const ArcIterator &other) const {
+      return target_ == other.target_;
+    }
+
+   private:
+    const size_t *target_ = nullptr;
+    const size_t *weight_ = nullptr;
+  };
+
+  class ArcRange {
+   public:
+    ArcRange(ArcIterator begin, ArcIterator end) : begin_(begin), end_(end) {}
+    ArcIterator begin() const { return begin_; }
+    ArcIterator end() const { return end_; }
+
+   private:
+    ArcIterator begin_;
+    ArcIterator end_;
+  };
+
+  CsrGraph() = default;
+  explicit CsrGraph(const Graph &graph);
+  CsrGraph(size_t size, const std::vector<Edge> &edges);
+
+  ArcRange GetArcs(size_t from) const;
+  Span<const size_t> GetTargets(size_t from) const;
+  Span<const size_t> GetWeights(size_t from) const;
+  size_t GetDegree(size_t from) const;
+  size_t GetSize() const;
+  size_t GetEdgeCount() const;
+  bool GraphIsEmpty() const;
+  Graph ToGraph() const;
+
+ private:
+  std::vector<size_t> offsets_{0};
+  std::vector<size_t> targets_;
+  std::vector<size_t> weights_;
+  size_t size_ = 0;
+
+  void CheckVertex(size_t vertex) const;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_S21_CSR_GRAPH_H_
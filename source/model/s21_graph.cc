@@ -1,6 +1,7 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include "s21_graph.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -8,31 +9,59 @@
 
 namespace s21 {
 
-Graph::Graph(size_t size)
-    : matrix_(
-          std::vector<std::vector<size_t>>(size, std::vector<size_t>(size, 0))),
-      size_(size) {}
+Graph::Graph(size_t size) : matrix_(size * size, 0), size_(size) {}
 
 Graph::Graph(size_t size, size_t init_value)
-    : matrix_(std::vector<std::vector<size_t>>(
-          size, std::vector<size_t>(size, init_value))),
-      size_(size) {}
+    : matrix_(size * size, init_value), size_(size) {}
+
+Graph::Graph(const MatrixAdjacency &matrix)
+    : matrix_(matrix.size() * matrix.size()), size_(matrix.size()) {
+  for (size_t row = 0; row < size_; ++row) {
+    if (matrix[row].size() != size_) {
+      throw std::length_error("The matrix is not square");
+    }
+    std::copy(matrix[row].begin(), matrix[row].end(),
+              matrix_.begin() + row * size_);
+  }
+}
 
 void Graph::SetValue(size_t row, size_t column, size_t value) {
   if (row >= size_ || column >= size_) {
     throw std::out_of_range("Cell index is out of range");
   }
 
-  matrix_[row][column] = value;
+  matrix_[row * size_ + column] = value;
+}
+
+Graph::MatrixAdjacency Graph::GetData() const {
+  MatrixAdjacency matrix(size_);
+  for (size_t row = 0; row < size_; ++row) {
+    Row values = GetRow(row);
+    matrix[row].assign(values.begin(), values.end());
+  }
+  return matrix;
+}
+
+Graph::Row Graph::GetFlatData() const {
+  return Row(matrix_.data(), matrix_.size());
 }
 
-Graph::MatrixAdjacency &Graph::GetData() { return matrix_; }
+Graph::Row Graph::GetRow(size_t row) const {
+  if (row >= size_) {
+    throw std::out_of_range("Cell index is out of range");
+  }
+  return Row(matrix_.data() + row * size_, size_);
+}
+
+Graph::ArcRange Graph::GetArcs(size_t from) const {
+  return ArcRange(GetRow(from), from);
+}
 
 size_t Graph::GetValue(size_t row, size_t column) const {
   if (row >= size_ || column >= size_) {
     throw std::out_of_range("Cell index is out of range");
   }
-  return matrix_[row][column];
+  return matrix_[row * size_ + column];
 }
 
 size_t Graph::GetSize() const { return size_; }
@@ -42,9 +71,10 @@ std::vector<size_t> Graph::GetNeighbors(size_t from) const {
     throw std::out_of_range("Cell index is out of range");
   }
   std::vector<size_t> neighbors;
+  Row row = GetRow(from);
   for (size_t to = 0; to < size_; ++to) {
-    if (from != to && matrix_[from][to] != 0) {
-      neighbors.push_back(matrix_[from][to]);
+    if (from != to && row[to] != 0) {
+      neighbors.push_back(row[to]);
     }
   }
   return neighbors;
@@ -86,7 +116,7 @@ void Graph::ExportGraphToDot(std::string filename) const {
     out << "graph " + filename + "{" << std::endl;
     for (size_t i = 0; i < size_; i++) {
       for (size_t j = i; j < size_; j++) {
-        if (matrix_[i][j]) {
+        if (matrix_[i * size_ + j]) {
           out << "vertex" << i + 1 << " -- vertex" << j + 1 << std::endl;
         }
       }
@@ -103,17 +133,16 @@ void Graph::ParseSize(std::string line) {
   if (size == 0) throw std::invalid_argument("The matrix has size zero");
   if (size < 0) throw std::invalid_argument("The matrix has incorrect size");
   size_ = size;
+  matrix_.assign(size_ * size_, 0);
 }
 
 void Graph::ParseLine(std::string line, size_t row) {
   size_t column = 0;
   std::stringstream ss(line);
-  std::vector<size_t> r;
-  matrix_.push_back(r);
   std::string token;
   while (ss >> token) {
     if (column >= size_) throw std::out_of_range("The matrix is wrong");
-    matrix_[row].push_back(std::stoi(token));
+    matrix_[row * size_ + column] = std::stoi(token);
     ++column;
   }
   if (column < size_) {
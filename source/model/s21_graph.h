@@ -5,18 +5,87 @@
 #include <string>
 #include <vector>
 
+#include "libs/s21_aligned_allocator.h"
+#include "libs/s21_span.h"
+
 namespace s21 {
 
+// Outgoing edge seen from its source vertex.
+struct Arc {
+  size_t to;
+  size_t weight;
+};
+
+struct Edge {
+  size_t from;
+  size_t to;
+  size_t weight;
+};
+
 class Graph {
  public:
   using MatrixAdjacency = std::vector<std::vector<size_t>>;
+  using Row = Span<const size_t>;
+
+  // Iterates the non-zero off-diagonal cells of one matrix row as arcs, so
+  // algorithms can be written once for dense and sparse graphs.
+  class ArcIterator {
+   public:
+    ArcIterator() = default;
+    ArcIterator(Row row, size_t from, size_t column)
+        : row_(row), from_(from), column_(column) {
+      SkipAbsent();
+    }
+
+    Arc operator*() const { return Arc{column_, row_[column_]}; }
+    ArcIterator &operator++() {
+      ++column_;
+      SkipAbsent();
+      return *this;
+    }
+    bool operator!=(const ArcIterator &other) const {
+      return column_ != other.column_;
+    }
+    bool operator==(const ArcIterator &other) const {
+      return column_ == other.column_;
+    }
+
+   private:
+    Row row_;
+    size_t from_ = 0;
+    size_t column_ = 0;
+
+    void SkipAbsent() {
+      while (column_ < row_.Size() &&
+             (column_ == from_ || row_[column_] == 0)) {
+        ++column_;
+      }
+    }
+  };
+
+  class ArcRange {
+   public:
+    ArcRange(Row row, size_t from) : row_(row), from_(from) {}
+    ArcIterator begin() const { return ArcIterator(row_, from_, 0); }
+    ArcIterator end() const { return ArcIterator(row_, from_, row_.Size()); }
+
+   private:
+    Row row_;
+    size_t from_;
+  };
 
   Graph() = default;
   explicit Graph(size_t size);
   Graph(size_t size, size_t init_value);
+  explicit Graph(const MatrixAdjacency &matrix);
 
   void SetValue(size_t row, size_t column, size_t value);
-  MatrixAdjacency &GetData();
+  // Copies the whole matrix into nested vectors, O(n^2) on every call; use
+  // GetValue, GetRow or GetFlatData to read it in place.
+  MatrixAdjacency GetData() const;
+  Row GetFlatData() const;
+  Row GetRow(size_t row) const;
+  ArcRange GetArcs(size_t from) const;
   size_t GetValue(size_t row, size_t column) const;
   size_t GetSize() const;
   std::vector<size_t> GetNeighbors(size_t from) const;
@@ -25,7 +94,8 @@ class Graph {
   bool GraphIsEmpty() const;
 
  private:
-  MatrixAdjacency matrix_;
+  // Row-major n x n adjacency matrix in a single cache-line-aligned block.
+  std::vector<size_t, AlignedAllocator<size_t>> matrix_;
   size_t size_ = 0;
   void ParseSize(std::string line);
   void ParseLine(std::string line, size_t row);
@@ -34,4 +104,4 @@ class Graph {
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_S21_GRAPH_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_S21_GRAPH_H_
@@ -1,48 +1,159 @@
 #include "s21_graph_algorithms.h"
 
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
 #include "libs/s21_queue.h"
 #include "libs/s21_stack.h"
+#include "shortest_path/all_pairs_shortest_paths.h"
 #include "traveling_salesman/ant_colony_algorithm/ant_colony_solver.h"
 #include "traveling_salesman/genetic_algorithm/crossover.h"
+#include "traveling_salesman/genetic_algorithm/edge_assembly_crossover.h"
 #include "traveling_salesman/genetic_algorithm/genetic_solver.h"
 #include "traveling_salesman/genetic_algorithm/mutation.h"
 #include "traveling_salesman/genetic_algorithm/selection.h"
+#include "traveling_salesman/lin_kernighan/lin_kernighan.h"
 #include "traveling_salesman/simulated_annealing/simulated_annealing.h"
 
 namespace s21 {
 
+namespace {
+
+TsmResult SolveGeneticAlgorithm(Graph& graph, const GeneticParams& params,
+                                const SolveControl& control) {
+  size_t number_generations =
+      control.IsBounded() ? std::numeric_limits<size_t>::max() : 50;
+  size_t population_size = 100;
+  double possible_mutation = 0.01;
+  double possible_crossover = 0.9;
+
+  TournamentSelection selection;
+  OrderedCrossover ordered;
+  EdgeRecombinationCrossover edge_recombination;
+  std::unique_ptr<EdgeAssemblyCrossover> edge_assembly;
+  CrossoverStrategy* crossover = &ordered;
+  if (params.crossover == CrossoverType::kEdgeRecombination) {
+    crossover = &edge_recombination;
+  } else if (params.crossover == CrossoverType::kEdgeAssembly) {
+    edge_assembly = std::make_unique<EdgeAssemblyCrossover>(
+        graph, params.eax_neighbour_count);
+    crossover = edge_assembly.get();
+  }
+  ExchangeMutation mutation;
+  GeneticAlgorithmTsp genetic_algorithm(graph, selection, *crossover,
+                                        mutation, params);
+  return genetic_algorithm.Solve(number_generations, population_size,
+                                 possible_mutation, possible_crossover,
+                                 control);
+}
+
+}  // namespace
+
 std::vector<size_t> GraphAlgorithms::DepthFirstSearch(Graph& graph,
                                                       size_t start_vertex) {
+  return DepthFirstSearchImpl(graph, start_vertex);
+}
+
+std::vector<size_t> GraphAlgorithms::DepthFirstSearch(const CsrGraph& graph,
+                                                      size_t start_vertex) {
+  return DepthFirstSearchImpl(graph, start_vertex);
+}
+
+std::vector<size_t> GraphAlgorithms::BreadthFirstSearch(Graph& graph,
+                                                        size_t start_vertex) {
+  return BreadthFirstSearchImpl(graph, start_vertex);
+}
+
+std::vector<size_t> GraphAlgorithms::BreadthFirstSearch(const CsrGraph& graph,
+                                                        size_t start_vertex) {
+  return BreadthFirstSearchImpl(graph, start_vertex);
+}
+
+size_t GraphAlgorithms::GetShortestPathBetweenVertices(
+    Graph& graph, size_t vertex1, size_t vertex2,
+    PriorityQueueType queue_type) {
+  return GetShortestRouteBetweenVerticesImpl(graph, vertex1, vertex2,
+                                             queue_type)
+      .distance;
+}
+
+size_t GraphAlgorithms::GetShortestPathBetweenVertices(
+    const CsrGraph& graph, size_t vertex1, size_t vertex2,
+    PriorityQueueType queue_type) {
+  return GetShortestRouteBetweenVerticesImpl(graph, vertex1, vertex2,
+                                             queue_type)
+      .distance;
+}
+
+RouteResult GraphAlgorithms::GetShortestRouteBetweenVertices(
+    Graph& graph, size_t vertex1, size_t vertex2,
+    PriorityQueueType queue_type) {
+  return GetShortestRouteBetweenVerticesImpl(graph, vertex1, vertex2,
+                                             queue_type);
+}
+
+RouteResult GraphAlgorithms::GetShortestRouteBetweenVertices(
+    const CsrGraph& graph, size_t vertex1, size_t vertex2,
+    PriorityQueueType queue_type) {
+  return GetShortestRouteBetweenVerticesImpl(graph, vertex1, vertex2,
+                                             queue_type);
+}
+
+template <class AdjacencyGraph>
+std::vector<size_t> GraphAlgorithms::DepthFirstSearchImpl(
+    const AdjacencyGraph& graph, size_t start_vertex) {
+  using ArcIterator = typename AdjacencyGraph::ArcIterator;
+
   if (start_vertex < 1)
     throw std::invalid_argument("Index of vertex is incorrect");
   if (start_vertex > graph.GetSize())
     throw std::out_of_range("Index of vertex is out of range");
   std::vector<bool> visited(graph.GetSize());
+  // Position of the first arc of every vertex on the stack that may still
+  // lead somewhere new; the arcs before it all reach visited vertices.
+  std::vector<ArcIterator> next_arc(graph.GetSize());
   size_t start = static_cast<size_t>(start_vertex) - 1;
   visited[start] = true;
+  next_arc[start] = graph.GetArcs(start).begin();
   Stack<size_t> stack;
   stack.Push(start);
   std::vector<size_t> result;
   result.push_back(start);
   while (!stack.Empty()) {
     size_t current = stack.Top();
-    bool vertex_has_children = false;
-    for (size_t i = 0; i < graph.GetSize(); ++i) {
-      if (graph.GetData()[current][i] && !visited[i]) {
-        visited[i] = true;
-        vertex_has_children = true;
-        stack.Push(i);
-        result.push_back(i);
-        current = i;
-      }
+    ArcIterator end = graph.GetArcs(current).end();
+    ArcIterator& first = next_arc[current];
+    while (first != end && visited[(*first).to]) ++first;
+    if (first == end) {
+      stack.Pop();
+      continue;
+    }
+    // One pass of the row scan the search has always made: on stepping to
+    // a vertex it goes on through that vertex's arcs to higher-numbered
+    // vertices before it starts again from the top of the stack. Arcs are
+    // sorted by target, and each vertex is entered once, so the passes
+    // look at every arc a bounded number of times.
+    ArcIterator arc = first;
+    while (true) {
+      while (arc != end && visited[(*arc).to]) ++arc;
+      if (arc == end) break;
+      size_t next = (*arc).to;
+      visited[next] = true;
+      next_arc[next] = graph.GetArcs(next).begin();
+      stack.Push(next);
+      result.push_back(next);
+      arc = next_arc[next];
+      end = graph.GetArcs(next).end();
+      while (arc != end && (*arc).to <= next) ++arc;
     }
-    if (!vertex_has_children) stack.Pop();
   }
   return result;
 }
 
-std::vector<size_t> GraphAlgorithms::BreadthFirstSearch(Graph& graph,
-                                                        size_t start_vertex) {
+template <class AdjacencyGraph>
+std::vector<size_t> GraphAlgorithms::BreadthFirstSearchImpl(
+    const AdjacencyGraph& graph, size_t start_vertex) {
   if (start_vertex < 1)
     throw std::invalid_argument("Index of vertex is incorrect");
   if (start_vertex > graph.GetSize())
@@ -57,140 +168,129 @@ std::vector<size_t> GraphAlgorithms::BreadthFirstSearch(Graph& graph,
   while (!queue.Empty()) {
     size_t current = queue.Front();
     queue.Pop();
-    for (size_t i = 0; i < graph.GetSize(); ++i) {
-      if (graph.GetData()[current][i] && !visited[i]) {
-        visited[i] = true;
-        queue.Push(i);
-        result.push_back(i);
+    for (Arc arc : graph.GetArcs(current)) {
+      if (!visited[arc.to]) {
+        visited[arc.to] = true;
+        queue.Push(arc.to);
+        result.push_back(arc.to);
       }
     }
   }
   return result;
 }
 
-size_t GraphAlgorithms::GetShortestPathBetweenVertices(Graph& graph,
-                                                       size_t vertex1,
-                                                       size_t vertex2) {
+template <class AdjacencyGraph>
+RouteResult GraphAlgorithms::GetShortestRouteBetweenVerticesImpl(
+    const AdjacencyGraph& graph, size_t vertex1, size_t vertex2,
+    PriorityQueueType queue_type) {
   if (vertex1 < 1 || vertex2 < 1)
     throw std::invalid_argument("Index of vertex is incorrect");
   if (vertex1 > graph.GetSize() || vertex2 > graph.GetSize())
     throw std::out_of_range("Index of vertex is out of range");
-  std::vector<size_t> min_length(graph.GetSize(),
-                                 std::numeric_limits<size_t>::max());
-  size_t start = vertex1 - 1;
-  size_t finish = vertex2 - 1;
-  min_length[start] = 0;
-  Queue<size_t> queue;
-  queue.Push(start);
-  while (!queue.Empty()) {
-    size_t vertex = queue.Front();
-    queue.Pop();
-    for (size_t i = 0; i < graph.GetSize(); ++i) {
-      size_t weight = graph.GetData()[vertex][i];
-      if (i != vertex && weight &&
-          min_length[vertex] + weight < min_length[i]) {
-        min_length[i] = min_length[vertex] + weight;
-        queue.Push(i);
-      }
-    }
-  }
-  return min_length[finish];
+  Dijkstra dijkstra(queue_type);
+  dijkstra.Run(graph, vertex1 - 1, vertex2 - 1);
+  return dijkstra.GetRoute(vertex2 - 1);
 }
 
 GraphAlgorithms::MatrixAdjacency
-GraphAlgorithms::GetShortestPathsBetweenAllVertices(Graph& graph) {
-  std::vector<std::vector<size_t>> result = graph.GetData();
-  const size_t kMax = std::numeric_limits<size_t>::max();
-  for (size_t i = 0; i < graph.GetSize(); ++i) {
-    for (size_t j = 0; j < graph.GetSize(); ++j) {
-      if (result[i][j] == 0) result[i][j] = i == j ? 0 : kMax;
-    }
-  }
-  for (size_t current = 0; current != graph.GetSize(); ++current) {
-    for (size_t i = 0; i != graph.GetSize(); ++i) {
-      for (size_t j = 0; j != graph.GetSize(); ++j) {
-        size_t weight = result[i][current] + result[current][j];
-        if (result[i][current] != kMax && result[current][j] != kMax &&
-            result[i][j] > weight)
-          result[i][j] = weight;
-      }
-    }
-  }
-  return result;
+GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+    Graph& graph, const AllPairsParams& params) {
+  return AllPairsShortestPaths(params).Solve(graph);
+}
+
+GraphAlgorithms::MatrixAdjacency
+GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+    const CsrGraph& graph, const AllPairsParams& params) {
+  return AllPairsShortestPaths(params).Solve(graph);
 }
 
 GraphAlgorithms::MatrixAdjacency GraphAlgorithms::GetLeastSpanningTree(
-    const Graph& graph) {
+    const Graph& graph, SpanningTreeAlgorithm algorithm) {
   size_t N = graph.GetSize();
   std::vector<std::vector<size_t>> spanning_tree(N, std::vector<size_t>(N, 0));
-  std::set<size_t> visited;
-  std::set<size_t> unvisited;
-
-  for (size_t i = 0; i < N; ++i) {
-    unvisited.insert(i);
+  for (const Edge& edge : GetLeastSpanningTreeEdges(graph, algorithm)) {
+    spanning_tree[edge.from][edge.to] = edge.weight;
+    spanning_tree[edge.to][edge.from] = edge.weight;
   }
+  return spanning_tree;
+}
 
-  auto first = unvisited.begin();
-  visited.insert(*first);
-  unvisited.erase(first);
-
-  while (!unvisited.empty()) {
-    std::pair<size_t, size_t> min_index = {0, 0};
-    size_t min_weight = std::numeric_limits<size_t>::max();
-
-    for (size_t curr : visited) {
-      for (size_t i = 0; i < N; ++i) {
-        size_t adj_weight = graph.GetValue(curr, i);
-        if (adj_weight <= min_weight && adj_weight != 0 && unvisited.count(i)) {
-          min_weight = adj_weight;
-          min_index = {curr, i};
-        }
-      }
-    }
-
-    spanning_tree[min_index.first][min_index.second] = min_weight;
-    spanning_tree[min_index.second][min_index.first] = min_weight;
-    unvisited.erase(min_index.second);
-    visited.insert(min_index.second);
-  }
+std::vector<Edge> GraphAlgorithms::GetLeastSpanningTreeEdges(
+    const Graph& graph, SpanningTreeAlgorithm algorithm) {
+  return MinimumSpanningTree(algorithm).Solve(graph);
+}
 
-  return spanning_tree;
+std::vector<Edge> GraphAlgorithms::GetLeastSpanningTreeEdges(
+    const CsrGraph& graph, SpanningTreeAlgorithm algorithm) {
+  return MinimumSpanningTree(algorithm).Solve(graph);
 }
 
-TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(Graph& graph) {
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(
+    Graph& graph, PheromoneUpdateType update_type,
+    const AntColonyParams& params) {
   size_t count_colony = 1;
   size_t size_colony = 1000;
 
-  AntColony ant_colony(graph, count_colony, size_colony);
+  AntSystemUpdate ant_system;
+  MaxMinAntSystemUpdate max_min_ant_system;
+  AntColonySystemUpdate ant_colony_system;
+  PheromoneUpdateStrategy* update = &ant_system;
+  if (update_type == PheromoneUpdateType::kMaxMinAntSystem) {
+    update = &max_min_ant_system;
+  } else if (update_type == PheromoneUpdateType::kAntColonySystem) {
+    update = &ant_colony_system;
+  }
+
+  AntColony ant_colony(graph, *update, count_colony, size_colony, params);
   TsmResult path = ant_colony.Solve();
 
   return path;
 }
 
-TsmResult GraphAlgorithms::SolveTravelingSalesmanProblemGeneticAlgorithm(
-    Graph& graph) {
-  size_t number_generations = 50;
-  size_t population_size = 100;
-  double possible_mutation = 0.01;
-  double possible_crossover = 0.9;
-
-  TournamentSelection selection;
-  OrderedCrossover crossover;
-  ExchangeMutation mutation;
-  GeneticAlgorithmTsp genetic_algorithm(graph, selection, crossover, mutation);
-
-  TsmResult path =
-      genetic_algorithm.Solve(number_generations, population_size,
-                              possible_mutation, possible_crossover);
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(
+    Graph& graph, TsmAlgorithm algorithm, const SolveControl& control,
+    const TsmParams& params) {
+  const size_t unlimited = std::numeric_limits<size_t>::max();
+  const bool bounded = control.IsBounded();
+  switch (algorithm) {
+    case TsmAlgorithm::kAntColony: {
+      AntColony ant_colony(graph, 1, bounded ? unlimited : 1000,
+                           params.ant_colony);
+      return ant_colony.Solve(control);
+    }
+    case TsmAlgorithm::kGeneticAlgorithm:
+      return SolveGeneticAlgorithm(graph, params.genetic, control);
+    case TsmAlgorithm::kSimulatedAnnealing: {
+      AnnealingParams annealing = params.annealing;
+      if (bounded) annealing.algorithm_reloads = unlimited;
+      return SimulatedAnnealing(graph, annealing).Solve(control);
+    }
+    case TsmAlgorithm::kLinKernighan: {
+      LinKernighanParams lin_kernighan = params.lin_kernighan;
+      if (bounded) lin_kernighan.kicks = unlimited;
+      return LinKernighan(graph, lin_kernighan).Solve(control);
+    }
+  }
+  throw std::invalid_argument("Unknown traveling salesman algorithm");
+}
 
-  return path;
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblemGeneticAlgorithm(
+    Graph& graph, const GeneticParams& params) {
+  return SolveGeneticAlgorithm(graph, params, SolveControl{});
 }
 
 TsmResult GraphAlgorithms::SolveTravelingSalesmanProblemSimulatedAnnealing(
-    const Graph& graph) {
-  SimulatedAnnealing simulated_annealing(graph, AnnealingParams{});
+    const Graph& graph, const AnnealingParams& params) {
+  SimulatedAnnealing simulated_annealing(graph, params);
 
   return simulated_annealing.Solve();
 }
 
+TsmResult GraphAlgorithms::SolveTravelingSalesmanProblemLinKernighan(
+    const Graph& graph, const LinKernighanParams& params) {
+  LinKernighan lin_kernighan(graph, params);
+
+  return lin_kernighan.Solve();
+}
+
 }  // namespace s21
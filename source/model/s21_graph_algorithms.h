@@ -1,10 +1,31 @@
 #ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_S21_GRAPH_ALGORITHMS_H_
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_S21_GRAPH_ALGORITHMS_H_
 
+#include "s21_csr_graph.h"
 #include "s21_graph.h"
+#include "shortest_path/all_pairs_params.h"
+#include "shortest_path/dijkstra.h"
+#include "spanning_tree/minimum_spanning_tree.h"
+#include "traveling_salesman/ant_colony_algorithm/ant_colony_params.h"
+#include "traveling_salesman/ant_colony_algorithm/pheromone_update.h"
 #include "traveling_salesman/common/path_structure.h"
+#include "traveling_salesman/common/solve_control.h"
+#include "traveling_salesman/genetic_algorithm/genetic_params.h"
+#include "traveling_salesman/lin_kernighan/lin_kernighan_params.h"
+#include "traveling_salesman/simulated_annealing/annealing_params.h"
 
 namespace s21 {
+
+// Settings of every solver the anytime SolveTravelingSalesmanProblem can
+// run; only those of the chosen one are read. A bounded run lifts its
+// solver's iteration limit whatever is set here.
+struct TsmParams {
+  AntColonyParams ant_colony{};
+  GeneticParams genetic{};
+  AnnealingParams annealing{};
+  LinKernighanParams lin_kernighan{};
+};
+
 class GraphAlgorithms {
  public:
   using MatrixAdjacency = std::vector<std::vector<size_t>>;
@@ -12,14 +33,71 @@ class GraphAlgorithms {
   GraphAlgorithms() = default;
 
   std::vector<size_t> DepthFirstSearch(Graph& graph, size_t start_vertex);
+  std::vector<size_t> DepthFirstSearch(const CsrGraph& graph,
+                                       size_t start_vertex);
   std::vector<size_t> BreadthFirstSearch(Graph& graph, size_t start_vertex);
-  size_t GetShortestPathBetweenVertices(Graph& graph, size_t vertex1,
-                                        size_t vertex2);
-  MatrixAdjacency GetShortestPathsBetweenAllVertices(Graph& graph);
-  MatrixAdjacency GetLeastSpanningTree(const Graph& graph);
-  TsmResult SolveTravelingSalesmanProblem(Graph& graph);
-  TsmResult SolveTravelingSalesmanProblemGeneticAlgorithm(Graph& graph);
-  TsmResult SolveTravelingSalesmanProblemSimulatedAnnealing(const Graph& graph);
+  std::vector<size_t> BreadthFirstSearch(const CsrGraph& graph,
+                                         size_t start_vertex);
+  size_t GetShortestPathBetweenVertices(
+      Graph& graph, size_t vertex1, size_t vertex2,
+      PriorityQueueType queue_type = PriorityQueueType::kDaryHeap);
+  size_t GetShortestPathBetweenVertices(
+      const CsrGraph& graph, size_t vertex1, size_t vertex2,
+      PriorityQueueType queue_type = PriorityQueueType::kDaryHeap);
+  RouteResult GetShortestRouteBetweenVertices(
+      Graph& graph, size_t vertex1, size_t vertex2,
+      PriorityQueueType queue_type = PriorityQueueType::kDaryHeap);
+  RouteResult GetShortestRouteBetweenVertices(
+      const CsrGraph& graph, size_t vertex1, size_t vertex2,
+      PriorityQueueType queue_type = PriorityQueueType::kDaryHeap);
+  MatrixAdjacency GetShortestPathsBetweenAllVertices(
+      Graph& graph, const AllPairsParams& params = AllPairsParams{});
+  MatrixAdjacency GetShortestPathsBetweenAllVertices(
+      const CsrGraph& graph, const AllPairsParams& params = AllPairsParams{});
+  MatrixAdjacency GetLeastSpanningTree(
+      const Graph& graph,
+      SpanningTreeAlgorithm algorithm = SpanningTreeAlgorithm::kAuto);
+  // Same tree as a list of its V - 1 edges (0-based), without the n x n
+  // matrix. Disconnected graphs give a spanning forest.
+  std::vector<Edge> GetLeastSpanningTreeEdges(
+      const Graph& graph,
+      SpanningTreeAlgorithm algorithm = SpanningTreeAlgorithm::kAuto);
+  std::vector<Edge> GetLeastSpanningTreeEdges(
+      const CsrGraph& graph,
+      SpanningTreeAlgorithm algorithm = SpanningTreeAlgorithm::kAuto);
+  TsmResult SolveTravelingSalesmanProblem(
+      Graph& graph,
+      PheromoneUpdateType update_type = PheromoneUpdateType::kAntSystem,
+      const AntColonyParams& params = AntColonyParams{});
+  // Anytime solve: reports every shorter tour to control.on_improvement
+  // and returns the best one once control.ShouldStop(). With a deadline or
+  // a cancellation token the solver runs until they stop it; without them
+  // it runs for the same budget as the method for that algorithm.
+  TsmResult SolveTravelingSalesmanProblem(
+      Graph& graph, TsmAlgorithm algorithm, const SolveControl& control,
+      const TsmParams& params = TsmParams{});
+  TsmResult SolveTravelingSalesmanProblemGeneticAlgorithm(
+      Graph& graph, const GeneticParams& params = GeneticParams{});
+  TsmResult SolveTravelingSalesmanProblemSimulatedAnnealing(
+      const Graph& graph, const AnnealingParams& params = AnnealingParams{});
+  TsmResult SolveTravelingSalesmanProblemLinKernighan(
+      const Graph& graph,
+      const LinKernighanParams& params = LinKernighanParams{});
+
+ private:
+  // Shared by the dense and CSR overloads: AdjacencyGraph only has to provide
+  // GetSize() and GetArcs(vertex), so the work is O(V + E) for sparse input.
+  template <class AdjacencyGraph>
+  std::vector<size_t> DepthFirstSearchImpl(const AdjacencyGraph& graph,
+                                           size_t start_vertex);
+  template <class AdjacencyGraph>
+  std::vector<size_t> BreadthFirstSearchImpl(const AdjacencyGraph& graph,
+                                             size_t start_vertex);
+  template <class AdjacencyGraph>
+  RouteResult GetShortestRouteBetweenVerticesImpl(const AdjacencyGraph& graph,
+                                                  size_t vertex1,
+                                                  size_t vertex2,
+                                                  PriorityQueueType queue_type);
 };
 }  // namespace s21
 
@@ -0,0 +1,33 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ALL_PAIRS_PARAMS_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ALL_PAIRS_PARAMS_H_
+
+#include <cstddef>
+
+#include "min_plus_kernel.h"
+
+namespace s21 {
+
+// kAuto runs Floyd-Warshall on dense graphs and Dijkstra from every source,
+// in parallel, on sparse ones.
+enum class AllPairsAlgorithm { kAuto, kFloydWarshall, kDijkstra };
+
+// Width of the Floyd-Warshall distances the all-pairs solver works with.
+// kAuto takes 32 bits whenever the longest possible simple path fits, k32
+// insists on it and fails when it does not.
+enum class DistanceWidth { kAuto, k32, k64 };
+
+struct AllPairsParams {
+  AllPairsAlgorithm algorithm{AllPairsAlgorithm::kAuto};
+  // kAuto picks Dijkstra when E / (V (V - 1)) is below this. The SIMD
+  // Floyd-Warshall is fast enough that repeated Dijkstra only wins on
+  // graphs with well under one percent of the possible arcs.
+  double dijkstra_max_density{0.005};
+  DistanceWidth distance_width{DistanceWidth::kAuto};
+  SimdLevel simd_level{SimdLevel::kAuto};
+  // Zero means one thread per hardware thread.
+  size_t thread_count{0};
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ALL_PAIRS_PARAMS_H_
@@ -0,0 +1,188 @@
+#include "all_pairs_shortest_paths.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "dijkstra.h"
+#include "floyd_warshall.h"
+#include "libs/s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+const size_t kUnreachable = std::numeric_limits<size_t>::max();
+
+// True when every simple path of a graph with `size` vertices stays below
+// the bounded infinity of the distance type.
+template <class Distance>
+bool FitsDistance(size_t size, size_t max_weight) {
+  const uint64_t kInfinity = MinPlusKernel<Distance>::kInfinity;
+  return size < 2 || max_weight == 0 ||
+         (size - 1) <= (kInfinity - 1) / max_weight;
+}
+
+template <class Distance>
+void FillDistances(const Graph &graph, std::vector<Distance> &distances) {
+  const size_t n = graph.GetSize();
+  const Distance kInfinity = MinPlusKernel<Distance>::kInfinity;
+  Graph::Row data = graph.GetFlatData();
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      size_t weight = data[i * n + j];
+      distances[i * n + j] =
+          weight != 0 ? static_cast<Distance>(weight) : i == j ? 0 : kInfinity;
+    }
+  }
+}
+
+template <class Distance>
+void FillDistances(const CsrGraph &graph, std::vector<Distance> &distances) {
+  const size_t n = graph.GetSize();
+  std::fill(distances.begin(), distances.end(),
+            MinPlusKernel<Distance>::kInfinity);
+  for (size_t from = 0; from < n; ++from) {
+    distances[from * n + from] = 0;
+    for (Arc arc : graph.GetArcs(from)) {
+      Distance &distance = distances[from * n + arc.to];
+      distance = std::min(distance, static_cast<Distance>(arc.weight));
+    }
+  }
+}
+
+}  // namespace
+
+AllPairsShortestPaths::AllPairsShortestPaths(const AllPairsParams &params)
+    : params_(params) {}
+
+AllPairsShortestPaths::MatrixAdjacency AllPairsShortestPaths::Solve(
+    const Graph &graph) const {
+  return SolveMeasured(graph, Measure(graph));
+}
+
+AllPairsShortestPaths::MatrixAdjacency AllPairsShortestPaths::Solve(
+    const CsrGraph &graph) const {
+  return SolveMeasured(graph, Measure(graph));
+}
+
+AllPairsAlgorithm AllPairsShortestPaths::ChooseAlgorithm(
+    const Graph &graph) const {
+  return ChooseAlgorithm(Measure(graph));
+}
+
+AllPairsAlgorithm AllPairsShortestPaths::ChooseAlgorithm(
+    const CsrGraph &graph) const {
+  return ChooseAlgorithm(Measure(graph));
+}
+
+AllPairsShortestPaths::GraphStats AllPairsShortestPaths::Measure(
+    const Graph &graph) {
+  GraphStats stats{graph.GetSize(), 0, 0, false};
+  for (size_t from = 0; from < stats.size; ++from) {
+    Graph::Row row = graph.GetRow(from);
+    for (size_t to = 0; to < stats.size; ++to) {
+      if (row[to] == 0) continue;
+      if (to == from) {
+        stats.has_diagonal = true;
+      } else {
+        ++stats.edge_count;
+      }
+      stats.max_weight = std::max(stats.max_weight, row[to]);
+    }
+  }
+  return stats;
+}
+
+AllPairsShortestPaths::GraphStats AllPairsShortestPaths::Measure(
+    const CsrGraph &graph) {
+  GraphStats stats{graph.GetSize(), graph.GetEdgeCount(), 0, false};
+  for (size_t from = 0; from < stats.size; ++from) {
+    for (size_t weight : graph.GetWeights(from)) {
+      stats.max_weight = std::max(stats.max_weight, weight);
+    }
+  }
+  return stats;
+}
+
+AllPairsAlgorithm AllPairsShortestPaths::ChooseAlgorithm(
+    const GraphStats &stats) const {
+  if (params_.algorithm != AllPairsAlgorithm::kAuto) {
+    return params_.algorithm;
+  }
+  if (stats.has_diagonal || stats.size < 2) {
+    return AllPairsAlgorithm::kFloydWarshall;
+  }
+  double density = static_cast<double>(stats.edge_count) /
+                   (static_cast<double>(stats.size) * (stats.size - 1));
+  return density < params_.dijkstra_max_density
+             ? AllPairsAlgorithm::kDijkstra
+             : AllPairsAlgorithm::kFloydWarshall;
+}
+
+template <class AdjacencyGraph>
+AllPairsShortestPaths::MatrixAdjacency AllPairsShortestPaths::SolveMeasured(
+    const AdjacencyGraph &graph, const GraphStats &stats) const {
+  if (ChooseAlgorithm(stats) == AllPairsAlgorithm::kDijkstra) {
+    if constexpr (std::is_same<AdjacencyGraph, CsrGraph>::value) {
+      return SolveDijkstra(graph);
+    } else {
+      return SolveDijkstra(CsrGraph(graph));
+    }
+  }
+
+  bool fits32 = FitsDistance<uint32_t>(stats.size, stats.max_weight);
+  if (params_.distance_width == DistanceWidth::k32 && !fits32) {
+    throw std::overflow_error("Edge weights are too large for 32 bits");
+  }
+  if (params_.distance_width != DistanceWidth::k64 && fits32) {
+    return SolveFloydWarshall<uint32_t>(graph);
+  }
+  if (!FitsDistance<uint64_t>(stats.size, stats.max_weight)) {
+    throw std::overflow_error("Edge weights are too large");
+  }
+  return SolveFloydWarshall<uint64_t>(graph);
+}
+
+template <class Distance, class AdjacencyGraph>
+AllPairsShortestPaths::MatrixAdjacency
+AllPairsShortestPaths::SolveFloydWarshall(const AdjacencyGraph &graph) const {
+  const size_t n = graph.GetSize();
+  const Distance kInfinity = MinPlusKernel<Distance>::kInfinity;
+  std::vector<Distance> distances(n * n);
+  FillDistances(graph, distances);
+  FloydWarshall(params_.thread_count, FloydWarshall::kDefaultBlockSize,
+                params_.simd_level)
+      .Solve(distances, n);
+
+  MatrixAdjacency result(n, std::vector<size_t>(n));
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      Distance distance = distances[i * n + j];
+      result[i][j] = distance >= kInfinity ? kUnreachable : distance;
+    }
+  }
+  return result;
+}
+
+// Sources are cut into a few chunks per thread; every chunk owns one
+// Dijkstra, so its heap and distance buffers are reused across sources.
+AllPairsShortestPaths::MatrixAdjacency AllPairsShortestPaths::SolveDijkstra(
+    const CsrGraph &graph) const {
+  const size_t n = graph.GetSize();
+  MatrixAdjacency result(n);
+  ThreadPool pool(std::min(ThreadPool::ResolveThreadCount(params_.thread_count),
+                           std::max<size_t>(1, n)));
+  const size_t chunks = std::min(n, pool.GetThreadCount() * 4);
+  pool.ParallelFor(chunks, [&](size_t chunk) {
+    Dijkstra dijkstra;
+    for (size_t source = chunk; source < n; source += chunks) {
+      dijkstra.Run(graph, source);
+      result[source] = dijkstra.GetDistances();
+    }
+  });
+  return result;
+}
+
+}  // namespace s21
@@ -0,0 +1,59 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ALL_PAIRS_SHORTEST_PATHS_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ALL_PAIRS_SHORTEST_PATHS_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "all_pairs_params.h"
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+
+namespace s21 {
+
+// All-pairs shortest distances as an n x n matrix with the size_t maximum
+// for unreachable pairs. Dense graphs go through the blocked SIMD
+// Floyd-Warshall, O(V^3); sparse ones through Dijkstra from every source,
+// O(V E log V) split over the sources. Weights are non-negative, so
+// Johnson's reweighting step is never needed.
+class AllPairsShortestPaths {
+ public:
+  using MatrixAdjacency = std::vector<std::vector<size_t>>;
+
+  explicit AllPairsShortestPaths(
+      const AllPairsParams &params = AllPairsParams{});
+
+  MatrixAdjacency Solve(const Graph &graph) const;
+  MatrixAdjacency Solve(const CsrGraph &graph) const;
+
+  // The algorithm Solve runs for this graph: the forced one, or the choice
+  // made from the measured edge density. A dense matrix with weights on its
+  // diagonal always takes Floyd-Warshall, which keeps them as the distance
+  // of a vertex to itself.
+  AllPairsAlgorithm ChooseAlgorithm(const Graph &graph) const;
+  AllPairsAlgorithm ChooseAlgorithm(const CsrGraph &graph) const;
+
+ private:
+  struct GraphStats {
+    size_t size;
+    size_t edge_count;
+    size_t max_weight;
+    bool has_diagonal;
+  };
+
+  AllPairsParams params_;
+
+  static GraphStats Measure(const Graph &graph);
+  static GraphStats Measure(const CsrGraph &graph);
+  AllPairsAlgorithm ChooseAlgorithm(const GraphStats &stats) const;
+
+  template <class AdjacencyGraph>
+  MatrixAdjacency SolveMeasured(const AdjacencyGraph &graph,
+                                const GraphStats &stats) const;
+  template <class Distance, class AdjacencyGraph>
+  MatrixAdjacency SolveFloydWarshall(const AdjacencyGraph &graph) const;
+  MatrixAdjacency SolveDijkstra(const CsrGraph &graph) const;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ALL_PAIRS_SHORTEST_PATHS_H_
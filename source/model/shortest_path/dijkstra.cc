@@ -0,0 +1,110 @@
+#include "dijkstra.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace s21 {
+
+Dijkstra::Dijkstra(PriorityQueueType queue_type) : queue_type_(queue_type) {}
+
+void Dijkstra::Run(const Graph &graph, size_t source, size_t target) {
+  Search(graph, source, target);
+}
+
+void Dijkstra::Run(const CsrGraph &graph, size_t source, size_t target) {
+  Search(graph, source, target);
+}
+
+size_t Dijkstra::GetDistance(size_t vertex) const {
+  if (vertex >= distances_.size()) {
+    throw std::out_of_range("Index of vertex is out of range");
+  }
+  return distances_[vertex];
+}
+
+const std::vector<size_t> &Dijkstra::GetDistances() const {
+  return distances_;
+}
+
+size_t Dijkstra::GetPredecessor(size_t vertex) const {
+  if (vertex >= predecessors_.size()) {
+    throw std::out_of_range("Index of vertex is out of range");
+  }
+  return predecessors_[vertex];
+}
+
+RouteResult Dijkstra::GetRoute(size_t target) const {
+  RouteResult route{{}, GetDistance(target)};
+  if (route.distance == kUnreachable) {
+    return route;
+  }
+  for (size_t vertex = target; vertex != kNoVertex;
+       vertex = predecessors_[vertex]) {
+    route.vertices.push_back(vertex);
+  }
+  std::reverse(route.vertices.begin(), route.vertices.end());
+  return route;
+}
+
+template <class AdjacencyGraph>
+void Dijkstra::Search(const AdjacencyGraph &graph, size_t source,
+                      size_t target) {
+  if (source >= graph.GetSize() ||
+      (target != kNoVertex && target >= graph.GetSize())) {
+    throw std::out_of_range("Index of vertex is out of range");
+  }
+  distances_.assign(graph.GetSize(), kUnreachable);
+  predecessors_.assign(graph.GetSize(), kNoVertex);
+  distances_[source] = 0;
+  if (queue_type_ == PriorityQueueType::kRadixHeap) {
+    SearchWithRadixHeap(graph, source, target);
+  } else {
+    SearchWithHeap(graph, source, target);
+  }
+}
+
+template <class AdjacencyGraph>
+void Dijkstra::SearchWithHeap(const AdjacencyGraph &graph, size_t source,
+                              size_t target) {
+  heap_.Reset(graph.GetSize());
+  heap_.Push(source, 0);
+  while (!heap_.Empty()) {
+    size_t vertex = heap_.Top();
+    size_t distance = heap_.TopKey();
+    heap_.Pop();
+    if (vertex == target) break;
+    for (Arc arc : graph.GetArcs(vertex)) {
+      size_t candidate = distance + arc.weight;
+      if (candidate < distances_[arc.to]) {
+        distances_[arc.to] = candidate;
+        predecessors_[arc.to] = vertex;
+        heap_.Push(arc.to, candidate);
+      }
+    }
+  }
+}
+
+// The radix heap has no decrease-key, so improved vertices are pushed again
+// and stale entries are skipped when they surface.
+template <class AdjacencyGraph>
+void Dijkstra::SearchWithRadixHeap(const AdjacencyGraph &graph, size_t source,
+                                   size_t target) {
+  radix_heap_.Clear();
+  radix_heap_.Push(0, source);
+  while (!radix_heap_.Empty()) {
+    auto [distance, vertex] = radix_heap_.Top();
+    radix_heap_.Pop();
+    if (distance != distances_[vertex]) continue;
+    if (vertex == target) break;
+    for (Arc arc : graph.GetArcs(vertex)) {
+      size_t candidate = distance + arc.weight;
+      if (candidate < distances_[arc.to]) {
+        distances_[arc.to] = candidate;
+        predecessors_[arc.to] = vertex;
+        radix_heap_.Push(candidate, arc.to);
+      }
+    }
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,62 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_DIJKSTRA_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_DIJKSTRA_H_
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "libs/s21_indexed_heap.h"
+#include "libs/s21_radix_heap.h"
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+#include "route_structure.h"
+
+namespace s21 {
+
+enum class PriorityQueueType { kDaryHeap, kRadixHeap };
+
+// Single-source shortest paths over non-negative integer weights. The
+// object keeps its buffers between runs, so repeated queries on graphs of
+// the same size do not reallocate.
+class Dijkstra {
+ public:
+  static constexpr size_t kUnreachable = std::numeric_limits<size_t>::max();
+  static constexpr size_t kNoVertex = std::numeric_limits<size_t>::max();
+
+  explicit Dijkstra(
+      PriorityQueueType queue_type = PriorityQueueType::kDaryHeap);
+
+  // Vertices are 0-based. The search stops as soon as `target` is settled;
+  // distances of vertices settled before it are final, the rest are upper
+  // bounds. With kNoVertex every reachable vertex is settled.
+  void Run(const Graph &graph, size_t source, size_t target = kNoVertex);
+  void Run(const CsrGraph &graph, size_t source, size_t target = kNoVertex);
+
+  size_t GetDistance(size_t vertex) const;
+  const std::vector<size_t> &GetDistances() const;
+  // Previous vertex on the best known path, kNoVertex for the source and
+  // for vertices not reached.
+  size_t GetPredecessor(size_t vertex) const;
+  // Follows predecessors back from a vertex settled by the last run.
+  RouteResult GetRoute(size_t target) const;
+
+ private:
+  PriorityQueueType queue_type_;
+  std::vector<size_t> distances_;
+  std::vector<size_t> predecessors_;
+  IndexedHeap<size_t> heap_;
+  RadixHeap<size_t> radix_heap_;
+
+  template <class AdjacencyGraph>
+  void Search(const AdjacencyGraph &graph, size_t source, size_t target);
+  template <class AdjacencyGraph>
+  void SearchWithHeap(const AdjacencyGraph &graph, size_t source,
+                      size_t target);
+  template <class AdjacencyGraph>
+  void SearchWithRadixHeap(const AdjacencyGraph &graph, size_t source,
+                           size_t target);
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_DIJKSTRA_H_
@@ -0,0 +1,86 @@
+#include "floyd_warshall.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace s21 {
+
+FloydWarshall::FloydWarshall(size_t thread_count, size_t block_size,
+                             SimdLevel simd_level)
+    : thread_count_(ThreadPool::ResolveThreadCount(thread_count)),
+      block_size_(block_size),
+      simd_level_(simd_level) {
+  if (block_size_ == 0) {
+    throw std::invalid_argument("Block size must be positive");
+  }
+}
+
+void FloydWarshall::Solve(std::vector<uint32_t> &distances, size_t size) {
+  SolveBlocked(distances, size);
+}
+
+void FloydWarshall::Solve(std::vector<uint64_t> &distances, size_t size) {
+  SolveBlocked(distances, size);
+}
+
+template <class Distance>
+void FloydWarshall::SolveBlocked(std::vector<Distance> &distances,
+                                 size_t size) {
+  if (distances.size() != size * size) {
+    throw std::length_error("Distance matrix does not match its size");
+  }
+  const MinPlusKernel<Distance> kernel(simd_level_);
+  const size_t blocks = (size + block_size_ - 1) / block_size_;
+  ThreadPool pool(
+      std::min(thread_count_, std::max<size_t>(1, blocks * blocks)));
+  Distance *data = distances.data();
+
+  for (size_t pivot = 0; pivot < blocks; ++pivot) {
+    UpdateTile(kernel, data, size, pivot, pivot, pivot);
+
+    pool.ParallelFor(2 * (blocks - 1), [&](size_t task) {
+      size_t other = task % (blocks - 1);
+      if (other >= pivot) ++other;
+      if (task < blocks - 1) {
+        UpdateTile(kernel, data, size, pivot, other, pivot);
+      } else {
+        UpdateTile(kernel, data, size, other, pivot, pivot);
+      }
+    });
+
+    pool.ParallelFor((blocks - 1) * (blocks - 1), [&](size_t task) {
+      size_t row = task / (blocks - 1);
+      size_t column = task % (blocks - 1);
+      if (row >= pivot) ++row;
+      if (column >= pivot) ++column;
+      UpdateTile(kernel, data, size, row, column, pivot);
+    });
+  }
+}
+
+// Relaxes one tile through every vertex of the pivot block. Going over the
+// pivots in the outer loop keeps the update correct when the tile is the
+// pivot tile itself or shares its row or column.
+template <class Distance>
+void FloydWarshall::UpdateTile(const MinPlusKernel<Distance> &kernel,
+                               Distance *distances, size_t size,
+                               size_t row_block, size_t column_block,
+                               size_t pivot_block) const {
+  const size_t row_begin = row_block * block_size_;
+  const size_t row_end = std::min(row_begin + block_size_, size);
+  const size_t column_begin = column_block * block_size_;
+  const size_t column_count =
+      std::min(column_begin + block_size_, size) - column_begin;
+  const size_t pivot_begin = pivot_block * block_size_;
+  const size_t pivot_end = std::min(pivot_begin + block_size_, size);
+
+  for (size_t k = pivot_begin; k < pivot_end; ++k) {
+    const Distance *pivot_row = distances + k * size + column_begin;
+    for (size_t i = row_begin; i < row_end; ++i) {
+      Distance *row = distances + i * size;
+      kernel(row + column_begin, pivot_row, row[k], column_count);
+    }
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,49 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_FLOYD_WARSHALL_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_FLOYD_WARSHALL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "libs/s21_thread_pool.h"
+#include "min_plus_kernel.h"
+
+namespace s21 {
+
+// Blocked Floyd-Warshall over a flat row-major distance matrix. Each round
+// solves the pivot tile, then the tiles sharing its row or column, then all
+// remaining tiles; tiles inside the last two phases are independent and are
+// spread over the thread pool.
+class FloydWarshall {
+ public:
+  // 64 x 64 tiles of 64-bit distances take 32 KiB, so the three tiles
+  // touched by an update stay in L2.
+  static constexpr size_t kDefaultBlockSize = 64;
+
+  // Zero threads means one per hardware thread.
+  explicit FloydWarshall(size_t thread_count = 0,
+                         size_t block_size = kDefaultBlockSize,
+                         SimdLevel simd_level = SimdLevel::kAuto);
+
+  // `distances` holds size x size entries, MinPlusKernel<Distance>::kInfinity
+  // for missing arcs, and is replaced by the shortest distances. 32-bit
+  // distances put twice as many lanes in a vector register.
+  void Solve(std::vector<uint32_t> &distances, size_t size);
+  void Solve(std::vector<uint64_t> &distances, size_t size);
+
+ private:
+  size_t thread_count_;
+  size_t block_size_;
+  SimdLevel simd_level_;
+
+  template <class Distance>
+  void SolveBlocked(std::vector<Distance> &distances, size_t size);
+  template <class Distance>
+  void UpdateTile(const MinPlusKernel<Distance> &kernel, Distance *distances,
+                  size_t size, size_t row_block, size_t column_block,
+                  size_t pivot_block) const;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_FLOYD_WARSHALL_H_
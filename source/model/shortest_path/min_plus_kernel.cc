@@ -0,0 +1,133 @@
+#include "min_plus_kernel.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMPLE_NAVIGATOR_X86 1
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+
+namespace {
+
+template <class Distance>
+void MinPlusRowScalar(Distance *row, const Distance *pivot_row,
+                      Distance through, size_t count) {
+  for (size_t j = 0; j < count; ++j) {
+    row[j] = std::min<Distance>(row[j], through + pivot_row[j]);
+  }
+}
+
+#ifdef SIMPLE_NAVIGATOR_X86
+
+__attribute__((target("sse4.1"))) void MinPlusRowSse4(uint32_t *row,
+                                                      const uint32_t *pivot_row,
+                                                      uint32_t through,
+                                                      size_t count) {
+  const __m128i add = _mm_set1_epi32(static_cast<int>(through));
+  size_t j = 0;
+  for (; j + 4 <= count; j += 4) {
+    __m128i current = _mm_loadu_si128(reinterpret_cast<__m128i *>(row + j));
+    __m128i candidate = _mm_add_epi32(
+        add, _mm_loadu_si128(reinterpret_cast<const __m128i *>(pivot_row + j)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(row + j),
+                     _mm_min_epu32(current, candidate));
+  }
+  MinPlusRowScalar(row + j, pivot_row + j, through, count - j);
+}
+
+__attribute__((target("sse4.2"))) void MinPlusRowSse4(uint64_t *row,
+                                                      const uint64_t *pivot_row,
+                                                      uint64_t through,
+                                                      size_t count) {
+  const __m128i add = _mm_set1_epi64x(static_cast<long long>(through));
+  size_t j = 0;
+  for (; j + 2 <= count; j += 2) {
+    __m128i current = _mm_loadu_si128(reinterpret_cast<__m128i *>(row + j));
+    __m128i candidate = _mm_add_epi64(
+        add, _mm_loadu_si128(reinterpret_cast<const __m128i *>(pivot_row + j)));
+    __m128i greater = _mm_cmpgt_epi64(current, candidate);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(row + j),
+                     _mm_blendv_epi8(current, candidate, greater));
+  }
+  MinPlusRowScalar(row + j, pivot_row + j, through, count - j);
+}
+
+__attribute__((target("avx2"))) void MinPlusRowAvx2(uint32_t *row,
+                                                    const uint32_t *pivot_row,
+                                                    uint32_t through,
+                                                    size_t count) {
+  const __m256i add = _mm256_set1_epi32(static_cast<int>(through));
+  size_t j = 0;
+  for (; j + 8 <= count; j += 8) {
+    __m256i current = _mm256_loadu_si256(reinterpret_cast<__m256i *>(row + j));
+    __m256i candidate = _mm256_add_epi32(
+        add,
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pivot_row + j)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(row + j),
+                        _mm256_min_epu32(current, candidate));
+  }
+  MinPlusRowScalar(row + j, pivot_row + j, through, count - j);
+}
+
+__attribute__((target("avx2"))) void MinPlusRowAvx2(uint64_t *row,
+                                                    const uint64_t *pivot_row,
+                                                    uint64_t through,
+                                                    size_t count) {
+  const __m256i add = _mm256_set1_epi64x(static_cast<long long>(through));
+  size_t j = 0;
+  for (; j + 4 <= count; j += 4) {
+    __m256i current = _mm256_loadu_si256(reinterpret_cast<__m256i *>(row + j));
+    __m256i candidate = _mm256_add_epi64(
+        add,
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pivot_row + j)));
+    __m256i greater = _mm256_cmpgt_epi64(current, candidate);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(row + j),
+                        _mm256_blendv_epi8(current, candidate, greater));
+  }
+  MinPlusRowScalar(row + j, pivot_row + j, through, count - j);
+}
+
+#endif  // SIMPLE_NAVIGATOR_X86
+
+}  // namespace
+
+SimdLevel DetectSimdLevel() {
+#ifdef SIMPLE_NAVIGATOR_X86
+  static const SimdLevel level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::kAvx2;
+    if (__builtin_cpu_supports("sse4.2")) return SimdLevel::kSse4;
+    return SimdLevel::kScalar;
+  }();
+  return level;
+#else
+  return SimdLevel::kScalar;
+#endif
+}
+
+template <class Distance>
+MinPlusKernel<Distance>::MinPlusKernel(SimdLevel level) {
+  SimdLevel supported = DetectSimdLevel();
+  level_ = level == SimdLevel::kAuto ? supported : std::min(level, supported);
+  switch (level_) {
+#ifdef SIMPLE_NAVIGATOR_X86
+    case SimdLevel::kAvx2:
+      row_update_ = &MinPlusRowAvx2;
+      break;
+    case SimdLevel::kSse4:
+      row_update_ = &MinPlusRowSse4;
+      break;
+#endif
+    default:
+      level_ = SimdLevel::kScalar;
+      row_update_ = &MinPlusRowScalar<Distance>;
+      break;
+  }
+}
+
+template class MinPlusKernel<uint32_t>;
+template class MinPlusKernel<uint64_t>;
+
+}  // namespace s21
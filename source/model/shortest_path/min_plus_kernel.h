@@ -0,0 +1,55 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_MIN_PLUS_KERNEL_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_MIN_PLUS_KERNEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace s21 {
+
+// Instruction set used by the min-plus kernel. kAuto picks the best one the
+// running CPU supports; asking for more than it supports falls back to the
+// best available level.
+enum class SimdLevel { kAuto, kScalar, kSse4, kAvx2 };
+
+SimdLevel DetectSimdLevel();
+
+// Row update at the heart of Floyd-Warshall:
+//   row[j] = min(row[j], through + pivot_row[j])
+// Distances use a bounded infinity instead of the type maximum: twice
+// kInfinity still fits (for 64-bit lanes even as a signed value, which the
+// SSE4.2/AVX2 compares need), so the add never overflows and the update is
+// a plain add and min in every lane. Every input must be <= kInfinity.
+template <class Distance>
+class MinPlusKernel {
+  static_assert(std::is_same<Distance, uint32_t>::value ||
+                    std::is_same<Distance, uint64_t>::value,
+                "Only 32 and 64 bit distances are supported");
+
+ public:
+  static constexpr Distance kInfinity =
+      std::numeric_limits<Distance>::max() >> (sizeof(Distance) == 8 ? 2 : 1);
+
+  explicit MinPlusKernel(SimdLevel level = SimdLevel::kAuto);
+
+  SimdLevel GetLevel() const { return level_; }
+
+  void operator()(Distance *row, const Distance *pivot_row, Distance through,
+                  size_t count) const {
+    row_update_(row, pivot_row, through, count);
+  }
+
+ private:
+  using RowUpdate = void (*)(Distance *, const Distance *, Distance, size_t);
+
+  SimdLevel level_;
+  RowUpdate row_update_;
+};
+
+extern template class MinPlusKernel<uint32_t>;
+extern template class MinPlusKernel<uint64_t>;
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_MIN_PLUS_KERNEL_H_
@@ -0,0 +1,18 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ROUTE_STRUCTURE_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ROUTE_STRUCTURE_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace s21 {
+
+// Point-to-point route: 0-based vertices from start to finish inclusive.
+// An unreachable finish gives no vertices and the maximum size_t distance.
+struct RouteResult {
+  std::vector<size_t> vertices;
+  size_t distance;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_SHORTEST_PATH_ROUTE_STRUCTURE_H_
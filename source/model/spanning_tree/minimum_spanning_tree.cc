@@ -0,0 +1,255 @@
+#include "minimum_spanning_tree.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <tuple>
+
+#include "libs/s21_concurrent_disjoint_set.h"
+#include "libs/s21_disjoint_set.h"
+#include "libs/s21_indexed_heap.h"
+#include "libs/s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+const size_t kNoVertex = std::numeric_limits<size_t>::max();
+const size_t kNoEdge = std::numeric_limits<size_t>::max();
+
+// Total order on undirected edges stored with from < to. Boruvka needs the
+// ties broken the same way by every component, or equal weights can close
+// a cycle.
+bool Lighter(const Edge &lhs, const Edge &rhs) {
+  return std::tie(lhs.weight, lhs.from, lhs.to) <
+         std::tie(rhs.weight, rhs.from, rhs.to);
+}
+
+bool SameEdge(const Edge &lhs, const Edge &rhs) {
+  return lhs.weight == rhs.weight && lhs.from == rhs.from && lhs.to == rhs.to;
+}
+
+// Whether the arc from -> to exists with this weight, so the arc back is a
+// duplicate of the same undirected edge.
+bool HasArc(const Graph &graph, size_t from, size_t to, size_t weight) {
+  return graph.GetRow(from)[to] == weight;
+}
+
+bool HasArc(const CsrGraph &graph, size_t from, size_t to, size_t weight) {
+  Span<const size_t> targets = graph.GetTargets(from);
+  const size_t *found = std::lower_bound(targets.begin(), targets.end(), to);
+  return found != targets.end() && *found == to &&
+         graph.GetWeights(from)[found - targets.begin()] == weight;
+}
+
+// Turned around, the arcs that have no arc of the same weight back, so
+// Prim can also reach a vertex along an arc that points at the tree. Empty
+// for a symmetric graph, whose out-arcs already cover every edge.
+template <class AdjacencyGraph>
+CsrGraph OneWayArcsReversed(const AdjacencyGraph &graph) {
+  std::vector<Edge> edges;
+  for (size_t from = 0; from < graph.GetSize(); ++from) {
+    for (Arc arc : graph.GetArcs(from)) {
+      if (!HasArc(graph, arc.to, from, arc.weight)) {
+        edges.push_back(Edge{arc.to, from, arc.weight});
+      }
+    }
+  }
+  return CsrGraph(graph.GetSize(), edges);
+}
+
+}  // namespace
+
+MinimumSpanningTree::MinimumSpanningTree(SpanningTreeAlgorithm algorithm,
+                                         size_t thread_count)
+    : algorithm_(algorithm), thread_count_(thread_count) {}
+
+std::vector<Edge> MinimumSpanningTree::Solve(const Graph &graph) const {
+  switch (algorithm_) {
+    case SpanningTreeAlgorithm::kKruskal:
+      return SolveKruskal(graph);
+    case SpanningTreeAlgorithm::kBoruvka:
+      return SolveBoruvka(graph);
+    default:
+      return SolvePrim(graph);
+  }
+}
+
+std::vector<Edge> MinimumSpanningTree::Solve(const CsrGraph &graph) const {
+  switch (algorithm_) {
+    case SpanningTreeAlgorithm::kPrim:
+      return SolvePrim(graph);
+    case SpanningTreeAlgorithm::kBoruvka:
+      return SolveBoruvka(graph);
+    default:
+      return SolveKruskal(graph);
+  }
+}
+
+template <class AdjacencyGraph>
+std::vector<Edge> MinimumSpanningTree::SolvePrim(const AdjacencyGraph &graph) {
+  const size_t n = graph.GetSize();
+  std::vector<Edge> tree;
+  tree.reserve(n > 0 ? n - 1 : 0);
+  std::vector<bool> in_tree(n, false);
+  std::vector<size_t> parent(n, kNoVertex);
+  const CsrGraph reversed = OneWayArcsReversed(graph);
+  // Key of a queued vertex: weight of the cheapest arc between it and the
+  // tree built so far, pointing either way.
+  IndexedHeap<size_t> heap(n);
+
+  for (size_t root = 0; root < n; ++root) {
+    if (in_tree[root]) continue;
+    heap.Push(root, 0);
+    while (!heap.Empty()) {
+      size_t vertex = heap.Top();
+      size_t weight = heap.TopKey();
+      heap.Pop();
+      in_tree[vertex] = true;
+      if (parent[vertex] != kNoVertex) {
+        tree.push_back(Edge{parent[vertex], vertex, weight});
+      }
+      auto relax = [&](Arc arc) {
+        if (in_tree[arc.to]) return;
+        if (!heap.Contains(arc.to) || arc.weight < heap.GetKey(arc.to)) {
+          heap.Push(arc.to, arc.weight);
+          parent[arc.to] = vertex;
+        }
+      };
+      for (Arc arc : graph.GetArcs(vertex)) relax(arc);
+      for (Arc arc : reversed.GetArcs(vertex)) relax(arc);
+    }
+  }
+  return tree;
+}
+
+template <class AdjacencyGraph>
+std::vector<Edge> MinimumSpanningTree::SolveKruskal(
+    const AdjacencyGraph &graph) {
+  const size_t n = graph.GetSize();
+  std::vector<Edge> candidates;
+  for (size_t from = 0; from < n; ++from) {
+    for (Arc arc : graph.GetArcs(from)) {
+      if (arc.to != from) candidates.push_back(Edge{from, arc.to, arc.weight});
+    }
+  }
+  // Ties are broken by the ends so the result does not depend on the sort.
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Edge &lhs, const Edge &rhs) {
+              return std::tie(lhs.weight, lhs.from, lhs.to) <
+                     std::tie(rhs.weight, rhs.from, rhs.to);
+            });
+
+  std::vector<Edge> tree;
+  tree.reserve(n > 0 ? n - 1 : 0);
+  DisjointSet components(n);
+  for (const Edge &edge : candidates) {
+    if (components.SetCount() == 1) break;
+    if (components.Union(edge.from, edge.to)) tree.push_back(edge);
+  }
+  return tree;
+}
+
+// Vertices and edges are both cut into a few contiguous chunks per thread.
+// Every round a chunk drops its edges that have become internal to a
+// component, in place, and offers the others to the cheapest-edge slot of
+// the two components they join; then the root of every component links
+// itself along its slot. A component whose slot edge is also the choice of
+// the component on the other side leaves the link to the smaller root, so
+// each edge is taken once.
+template <class AdjacencyGraph>
+std::vector<Edge> MinimumSpanningTree::SolveBoruvka(
+    const AdjacencyGraph &graph) const {
+  const size_t n = graph.GetSize();
+  std::vector<Edge> tree;
+  if (n < 2) return tree;
+  tree.reserve(n - 1);
+  ThreadPool pool(std::min(ThreadPool::ResolveThreadCount(thread_count_), n));
+  const size_t chunks = std::min(n, pool.GetThreadCount() * 4);
+  const size_t chunk_vertices = (n + chunks - 1) / chunks;
+  auto vertex_begin = [&](size_t chunk) {
+    return std::min(n, chunk * chunk_vertices);
+  };
+
+  std::vector<std::vector<Edge>> chunk_edges(chunks);
+  pool.ParallelFor(chunks, [&](size_t chunk) {
+    for (size_t from = vertex_begin(chunk); from < vertex_begin(chunk + 1);
+         ++from) {
+      for (Arc arc : graph.GetArcs(from)) {
+        if (arc.to == from ||
+            (arc.to < from && HasArc(graph, arc.to, from, arc.weight))) {
+          continue;
+        }
+        chunk_edges[chunk].push_back(Edge{std::min(from, arc.to),
+                                          std::max(from, arc.to), arc.weight});
+      }
+    }
+  });
+  std::vector<size_t> edge_begin(chunks + 1, 0);
+  for (size_t chunk = 0; chunk < chunks; ++chunk) {
+    edge_begin[chunk + 1] = edge_begin[chunk] + chunk_edges[chunk].size();
+  }
+  std::vector<Edge> edges(edge_begin[chunks]);
+  std::vector<size_t> edge_end(edge_begin.begin() + 1, edge_begin.end());
+  pool.ParallelFor(chunks, [&](size_t chunk) {
+    std::copy(chunk_edges[chunk].begin(), chunk_edges[chunk].end(),
+              edges.begin() + edge_begin[chunk]);
+    std::vector<Edge>().swap(chunk_edges[chunk]);
+  });
+
+  ConcurrentDisjointSet components(n);
+  std::vector<size_t> component(n);
+  std::vector<std::atomic<size_t>> cheapest(n);
+  std::vector<std::vector<Edge>> chunk_tree(chunks);
+  auto offer = [&](size_t root, size_t index) {
+    size_t current = cheapest[root].load(std::memory_order_acquire);
+    while ((current == kNoEdge || Lighter(edges[index], edges[current])) &&
+           !cheapest[root].compare_exchange_weak(current, index,
+                                                 std::memory_order_acq_rel)) {
+    }
+  };
+
+  bool merged = true;
+  while (merged) {
+    pool.ParallelFor(chunks, [&](size_t chunk) {
+      for (size_t v = vertex_begin(chunk); v < vertex_begin(chunk + 1); ++v) {
+        component[v] = components.Find(v);
+        cheapest[v].store(kNoEdge, std::memory_order_relaxed);
+      }
+    });
+    pool.ParallelFor(chunks, [&](size_t chunk) {
+      size_t kept = edge_begin[chunk];
+      for (size_t i = edge_begin[chunk]; i < edge_end[chunk]; ++i) {
+        size_t from = component[edges[i].from];
+        size_t to = component[edges[i].to];
+        if (from == to) continue;
+        edges[kept] = edges[i];
+        offer(from, kept);
+        offer(to, kept);
+        ++kept;
+      }
+      edge_end[chunk] = kept;
+    });
+    pool.ParallelFor(chunks, [&](size_t chunk) {
+      for (size_t v = vertex_begin(chunk); v < vertex_begin(chunk + 1); ++v) {
+        size_t index = cheapest[v].load(std::memory_order_relaxed);
+        if (component[v] != v || index == kNoEdge) continue;
+        const Edge &edge = edges[index];
+        size_t other = component[edge.from] == v ? component[edge.to]
+                                                 : component[edge.from];
+        size_t back = cheapest[other].load(std::memory_order_relaxed);
+        if (other < v && SameEdge(edges[back], edge)) continue;
+        if (components.Union(v, other)) chunk_tree[chunk].push_back(edge);
+      }
+    });
+    merged = false;
+    for (std::vector<Edge> &picked : chunk_tree) {
+      merged = merged || !picked.empty();
+      tree.insert(tree.end(), picked.begin(), picked.end());
+      picked.clear();
+    }
+  }
+  return tree;
+}
+
+}  // namespace s21
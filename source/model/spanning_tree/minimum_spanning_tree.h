@@ -0,0 +1,53 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_SPANNING_TREE_MINIMUM_SPANNING_TREE_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_SPANNING_TREE_MINIMUM_SPANNING_TREE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+
+namespace s21 {
+
+// kAuto runs Prim on adjacency matrices and Kruskal on CSR graphs, whose
+// arcs are already a compact edge list to sort. kBoruvka is the parallel
+// one and has to be asked for.
+enum class SpanningTreeAlgorithm { kAuto, kPrim, kKruskal, kBoruvka };
+
+// Minimum spanning forest of a graph read as undirected: every arc joins its
+// two ends. A connected graph gives V - 1 edges, otherwise each component
+// gets a tree of its own. Prim keeps an indexed heap of the cheapest arc
+// either way between the tree and every vertex, following arcs out of and
+// into each vertex it adds, O(E log V); Kruskal sorts the arcs and merges
+// components with a union-find, O(E log E). Boruvka lets every component
+// pick its cheapest outgoing edge in parallel and contracts them through a
+// concurrent union-find, O(E log V) work over at most log V rounds.
+class MinimumSpanningTree {
+ public:
+  // Zero threads means one per hardware thread; only Boruvka uses them.
+  explicit MinimumSpanningTree(
+      SpanningTreeAlgorithm algorithm = SpanningTreeAlgorithm::kAuto,
+      size_t thread_count = 0);
+
+  // Vertices are 0-based. Prim lists the edges in the order the vertices
+  // join the tree, `from` being the tree side; Kruskal by ascending weight;
+  // Boruvka round by round with `from` < `to`, the same for any number of
+  // threads. All of them give the same total weight.
+  std::vector<Edge> Solve(const Graph &graph) const;
+  std::vector<Edge> Solve(const CsrGraph &graph) const;
+
+ private:
+  SpanningTreeAlgorithm algorithm_;
+  size_t thread_count_;
+
+  template <class AdjacencyGraph>
+  static std::vector<Edge> SolvePrim(const AdjacencyGraph &graph);
+  template <class AdjacencyGraph>
+  static std::vector<Edge> SolveKruskal(const AdjacencyGraph &graph);
+  template <class AdjacencyGraph>
+  std::vector<Edge> SolveBoruvka(const AdjacencyGraph &graph) const;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_SPANNING_TREE_MINIMUM_SPANNING_TREE_H_
@@ -1,54 +1,58 @@
 #include "ant.h"
 
-#include <cmath>
+#include <algorithm>
+#include <limits>
 
 namespace s21 {
 
-Ant::Ant(Graph &distances, std::mt19937 &gen, double pheromon_quantiy)
+Ant::Ant(Graph &distances, const CsrGraph &adjacency, double exploitation)
     : distances_(distances),
-      gen_(gen),
-      pheromon_quantiy_(pheromon_quantiy),
+      adjacency_(adjacency),
+      exploitation_(exploitation),
       used_vertex_(std::vector<bool>(distances.GetSize(), false)) {
-  std::uniform_int_distribution<size_t> dist_{0, distances.GetSize() - 1};
-  size_t start_vertex = dist_(gen_);
+  path_.vertices.reserve(distances.GetSize() + 1);
+}
+
+void Ant::Reset(RandomStream &gen) {
+  gen_ = &gen;
+  std::fill(used_vertex_.begin(), used_vertex_.end(), false);
+  path_.vertices.clear();
+  std::uniform_int_distribution<size_t> dist_{0, distances_.GetSize() - 1};
+  size_t start_vertex = dist_(*gen_);
   path_.vertices.push_back(start_vertex);
   used_vertex_[start_vertex] = true;
   path_.distance = 0;
 }
 
-bool Ant::Move(const Pheromones &pheromones) {
-  std::vector<size_t> neighbors = GetVerticesPossibleNeighbors();
-  if (neighbors.empty() && path_.vertices.size() == distances_.GetSize()) {
-    path_.distance +=
-        GetDistanceBetweenVertices(GetLastVertex(), GetFirstVertex());
-    path_.vertices.push_back(GetFirstVertex());
-  }
-
-  if (neighbors.empty()) {
-    return false;
+bool Ant::Move(const ChoiceInfo &choice_info) {
+  size_t current_vertex = GetLastVertex();
+  bool exploit = exploitation_ > 0 &&
+                 std::uniform_real_distribution<double>{0.0, 1.0}(*gen_) <
+                     exploitation_;
+  size_t next_vertex = ChooseNextVertex(
+      choice_info, choice_info.GetCandidates(current_vertex), exploit);
+  if (next_vertex == kNoVertex) {
+    next_vertex = ChooseNextVertex(
+        choice_info, adjacency_.GetTargets(current_vertex), exploit);
   }
 
-  std::vector<double> probabilities = GetProbabilities(pheromones, neighbors);
-  double probability = GetRandomProbability();
-
-  for (size_t i = 0; i < probabilities.size(); ++i) {
-    if (probability <= probabilities[i]) {
-      size_t next_vertex = neighbors[i];
+  if (next_vertex == kNoVertex) {
+    if (path_.vertices.size() == distances_.GetSize()) {
       path_.distance +=
-          GetDistanceBetweenVertices(GetLastVertex(), next_vertex);
-      path_.vertices.push_back(next_vertex);
-      used_vertex_[next_vertex] = true;
-      break;
+          GetDistanceBetweenVertices(GetLastVertex(), GetFirstVertex());
+      path_.vertices.push_back(GetFirstVertex());
     }
+    return false;
   }
 
+  path_.distance += GetDistanceBetweenVertices(current_vertex, next_vertex);
+  path_.vertices.push_back(next_vertex);
+  used_vertex_[next_vertex] = true;
   return true;
 }
 
 const TsmResult &Ant::GetPath() const { return path_; }
 
-double Ant::GetPheromonQuantiy() const { return pheromon_quantiy_; }
-
 double Ant::GetDistanceBetweenVertices(size_t from, size_t to) const {
   size_t distance = distances_.GetValue(from, to);
   if (distance == 0 && from != to) {
@@ -62,63 +66,36 @@ size_t Ant::GetFirstVertex() { return path_.vertices.front(); }
 
 size_t Ant::GetLastVertex() { return path_.vertices.back(); }
 
-std::vector<double> Ant::GetProbabilities(const Pheromones &pheromones,
-                                          std::vector<size_t> &neighbors) {
-  std::vector<double> probabilities;
-  probabilities.reserve(neighbors.size());
-
-  double summaryWeight = CalcSummaryWeight(pheromones, neighbors);
-
+size_t Ant::ChooseNextVertex(const ChoiceInfo &choice_info,
+                             Span<const size_t> options, bool exploit) {
   size_t current_vertex = GetLastVertex();
-  for (auto &neighbor : neighbors) {
-    double probability =
-        pow(kDistance / distances_.GetValue(current_vertex, neighbor), kBetta) *
-        pow(pheromones.GetValue(current_vertex, neighbor), kAlpha) /
-        summaryWeight;
-    if (probabilities.empty()) {
-      probabilities.push_back(probability);
-    } else {
-      probabilities.push_back(probabilities.back() + probability);
+  double summary_weight = 0;
+  size_t last_option = kNoVertex;
+  size_t best_option = kNoVertex;
+  for (size_t option : options) {
+    if (!used_vertex_[option]) {
+      double weight = choice_info.GetValue(current_vertex, option);
+      if (best_option == kNoVertex ||
+          weight > choice_info.GetValue(current_vertex, best_option)) {
+        best_option = option;
+      }
+      summary_weight += weight;
+      last_option = option;
     }
   }
+  if (last_option == kNoVertex || exploit) {
+    return best_option;
+  }
 
-  return probabilities;
-}
-
-double Ant::GetRandomProbability() {
-  std::uniform_real_distribution<double> dist_{0.0, 1.0};
-  double probability = dist_(gen_);
-  return probability;
-}
-
-std::vector<size_t> Ant::GetVerticesPossibleNeighbors() {
-  size_t current_vertex = GetLastVertex();
-  std::vector<size_t> neighbors;
-
-  for (size_t to_vertex = 0; to_vertex < distances_.GetSize(); ++to_vertex) {
-    if (to_vertex != current_vertex && !used_vertex_[to_vertex] &&
-        distances_.GetValue(current_vertex, to_vertex) != 0) {
-      neighbors.push_back(to_vertex);
+  std::uniform_real_distribution<double> dist_{0.0, summary_weight};
+  double remaining = dist_(*gen_);
+  for (size_t option : options) {
+    if (!used_vertex_[option]) {
+      remaining -= choice_info.GetValue(current_vertex, option);
+      if (remaining < 0) return option;
     }
   }
-
-  return neighbors;
-}
-
-double Ant::CalcSummaryWeight(const Pheromones &pheromones,
-                              std::vector<size_t> &neighbors) {
-  size_t current_vertex = GetLastVertex();
-
-  double summaryWeight = std::accumulate(
-      neighbors.begin(), neighbors.end(), 0.0,
-      [&](double acc, const auto &neighbor) {
-        return acc +
-               pow(kDistance / distances_.GetValue(current_vertex, neighbor),
-                   kBetta) *
-                   pow(pheromones.GetValue(current_vertex, neighbor), kAlpha);
-      });
-
-  return summaryWeight;
+  return last_option;
 }
 
 }  // namespace s21
@@ -4,42 +4,50 @@
 #include <random>
 #include <vector>
 
+#include "choice_info.h"
+#include "libs/s21_random_stream.h"
+#include "libs/s21_span.h"
+#include "model/s21_csr_graph.h"
 #include "model/s21_graph.h"
 #include "model/traveling_salesman/common/path_structure.h"
-#include "pheromone.h"
 
 namespace s21 {
 
+// One ant and the buffers of its tour. An ant is reused for tour after
+// tour: Reset keeps the storage, so walking allocates nothing once the
+// first tour has sized the path.
 class Ant {
  public:
-  const double kAlpha = 1;
-  const double kBetta = 1;
-  const double kDistance = 1;
-
-  Ant(Graph &distances, std::mt19937 &gen, double pheromon_quantiy);
+  // With probability `exploitation` a step goes to the candidate with the
+  // largest choice value instead of a drawn one.
+  Ant(Graph &distances, const CsrGraph &adjacency, double exploitation = 0);
 
+  // Starts a new tour from a random city. The tour draws from `gen` until
+  // the next Reset, so it has to outlive the walk.
+  void Reset(RandomStream &gen);
   const TsmResult &GetPath() const;
-  double GetPheromonQuantiy() const;
-  bool Move(const Pheromones &pheromones);
+  // Steps to an unvisited city drawn in proportion to its choice value,
+  // among the nearest candidates first and among every neighbour once the
+  // candidates are all visited.
+  bool Move(const ChoiceInfo &choice_info);
 
  private:
+  static constexpr size_t kNoVertex = static_cast<size_t>(-1);
+
   Graph &distances_;
-  std::mt19937 &gen_;
-  double pheromon_quantiy_;
+  const CsrGraph &adjacency_;
+  RandomStream *gen_{nullptr};
+  double exploitation_;
   std::vector<bool> used_vertex_;
   TsmResult path_{};
 
   double GetDistanceBetweenVertices(size_t from, size_t to) const;
   size_t GetFirstVertex();
   size_t GetLastVertex();
-  std::vector<double> GetProbabilities(const Pheromones &pheromones,
-                                       std::vector<size_t> &neighbors);
-  double GetRandomProbability();
-  std::vector<size_t> GetVerticesPossibleNeighbors();
-  double CalcSummaryWeight(const Pheromones &pheromones,
-                           std::vector<size_t> &neighbors);
+  size_t ChooseNextVertex(const ChoiceInfo &choice_info,
+                          Span<const size_t> options, bool exploit);
 };
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_ANT_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_ANT_H_
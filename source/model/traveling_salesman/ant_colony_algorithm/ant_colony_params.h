@@ -0,0 +1,36 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_ANT_COLONY_PARAMS_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_ANT_COLONY_PARAMS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace s21 {
+
+struct AntColonyParams {
+  // Weights of the pheromone trail and of the inverse distance in the
+  // probability of a step, tau^alpha * eta^beta.
+  double alpha{1};
+  double beta{1};
+  // An ant looks at this many nearest cities first and scans every
+  // neighbour only once all of them are visited.
+  size_t candidate_count{15};
+  // Ants that build their tours together on the same pheromone levels; the
+  // trails are updated once after each such iteration, so a colony of
+  // size_colony ants learns over size_colony / ants_per_iteration steps.
+  // One keeps the classic colony, every ant updating the trails before
+  // the next walks; more let the ants of an iteration walk in parallel.
+  size_t ants_per_iteration{1};
+  // Zero means one thread per hardware thread.
+  size_t thread_count{0};
+  // Runs 2-opt and Or-opt on the best tour of every iteration before it
+  // lays its pheromones, which takes far fewer ants to reach good tours.
+  bool local_search{false};
+  // Runs with the same seed give the same tour whatever thread_count is;
+  // without one the seed is taken from std::random_device.
+  std::optional<uint64_t> seed{};
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_ANT_COLONY_PARAMS_H_
@@ -1,45 +1,122 @@
 #include "ant_colony_solver.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "model/traveling_salesman/common/local_search.h"
 #include "pheromone.h"
 
 namespace s21 {
 
-AntColony::AntColony(Graph &graph, size_t count_colony, size_t size_colony)
-    : graph_(graph), count_colony_(count_colony), size_colony_(size_colony) {}
+AntColony::AntColony(Graph &graph, size_t count_colony, size_t size_colony,
+                     const AntColonyParams &params)
+    : AntColony(graph, default_update_, count_colony, size_colony, params) {}
+
+AntColony::AntColony(Graph &graph, PheromoneUpdateStrategy &update,
+                     size_t count_colony, size_t size_colony,
+                     const AntColonyParams &params)
+    : graph_(graph),
+      update_(update),
+      count_colony_(count_colony),
+      size_colony_(size_colony),
+      params_(params) {}
 
-TsmResult AntColony::Solve() {
+TsmResult AntColony::Solve(const SolveControl &control) {
   TsmResult min_path;
   min_path.distance = std::numeric_limits<double>::infinity();
   if (graph_.GetSize() == 0) {
     return min_path;
   }
 
-  for (size_t i = 0; i < count_colony_; ++i) {
-    Pheromones pheromones(graph_.GetSize(), kPheromonInitialLevel,
-                          kPheromoneEvaporationRate);
-    CreateAntColony();
+  adjacency_ = CsrGraph(graph_);
+  const size_t ants_per_iteration =
+      std::max<size_t>(1, params_.ants_per_iteration);
+  ThreadPool pool(std::min(ThreadPool::ResolveThreadCount(params_.thread_count),
+                           ants_per_iteration));
+  const uint64_t seed =
+      params_.seed ? *params_.seed : RandomStream::RandomSeed();
+  streams_.clear();
+  for (size_t i = 0; i < ants_per_iteration; ++i) {
+    streams_.emplace_back(seed, i);
+  }
 
-    for (auto &ant : ant_colony) {
-      while (ant.Move(pheromones)) {
+  ChoiceInfo choice_info(adjacency_, params_.alpha, params_.beta,
+                         params_.candidate_count);
+  CreateAntColony(pool.GetThreadCount(), ants_per_iteration);
+  std::optional<LocalSearch> local_search;
+  if (params_.local_search) local_search.emplace(graph_);
+  ImprovementReporter reporter(control);
+
+  bool stopped = false;
+  for (size_t i = 0; i < count_colony_ && !stopped; ++i) {
+    Pheromones pheromones(graph_.GetSize(), kPheromonInitialLevel,
+                          update_.GetEvaporationRate(ants_per_iteration));
+    update_.Initialize(pheromones, graph_.GetSize());
+    choice_info.Refresh(pheromones);
+    for (size_t done = 0; done < size_colony_ && !stopped;
+         done += ants_per_iteration) {
+      size_t size = std::min(ants_per_iteration, size_colony_ - done);
+      RunIteration(pool, choice_info, size);
+      if (local_search) {
+        TsmResult &best = *std::min_element(
+            tours_.begin(), tours_.begin() + size,
+            [](const TsmResult &lhs, const TsmResult &rhs) {
+              return lhs.distance < rhs.distance;
+            });
+        if (best.vertices.size() == graph_.GetSize() + 1) {
+          local_search->Improve(best);
+        }
       }
-      const TsmResult &path = ant.GetPath();
-      pheromones.Update(path, ant.GetPheromonQuantiy());
-      if (path.vertices.size() == (graph_.GetSize() + 1) &&
-          path.distance < min_path.distance) {
-        min_path = std::move(path);
+
+      for (size_t ant = 0; ant < size; ++ant) {
+        if (tours_[ant].distance < min_path.distance) {
+          min_path = tours_[ant];
+        }
       }
+      reporter.Offer(min_path);
+      update_.Execute(pheromones, Span<const TsmResult>(tours_.data(), size),
+                      min_path);
+      choice_info.RefreshDeposits(pheromones);
+      pheromones.Evaporate();
+      // Only does work when evaporating rescaled or moved the lower bound.
+      choice_info.RefreshDeposits(pheromones);
+      stopped = control.ShouldStop();
     }
   }
 
   return min_path;
 }
 
-void AntColony::CreateAntColony() {
+// One reusable Ant per thread.
+void AntColony::CreateAntColony(size_t thread_count,
+                                size_t ants_per_iteration) {
   ant_colony.clear();
-  ant_colony.reserve(size_colony_);
-  for (size_t i = 0; i < size_colony_; ++i) {
-    ant_colony.push_back(Ant(graph_, gen_, kPheromoneQuantiy));
+  ant_colony.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i) {
+    ant_colony.push_back(Ant(graph_, adjacency_, update_.GetExploitation()));
   }
+  tours_.resize(ants_per_iteration);
+  for (TsmResult &tour : tours_) {
+    tour.vertices.reserve(graph_.GetSize() + 1);
+  }
+}
+
+void AntColony::RunIteration(ThreadPool &pool, const ChoiceInfo &choice_info,
+                             size_t size) {
+  pool.ParallelFor(ant_colony.size(), [&](size_t thread) {
+    Ant &ant = ant_colony[thread];
+    for (size_t i = thread; i < size; i += ant_colony.size()) {
+      ant.Reset(streams_[i]);
+      while (ant.Move(choice_info)) {
+      }
+      tours_[i] = ant.GetPath();
+      if (tours_[i].vertices.size() != graph_.GetSize() + 1) {
+        tours_[i].distance = std::numeric_limits<double>::infinity();
+      }
+    }
+  });
 }
 
 }  // namespace s21
@@ -4,29 +4,58 @@
 #include <vector>
 
 #include "ant.h"
+#include "ant_colony_params.h"
+#include "choice_info.h"
+#include "pheromone_update.h"
+#include "libs/s21_random_stream.h"
+#include "libs/s21_thread_pool.h"
 #include "model/s21_graph.h"
 #include "model/traveling_salesman/common/path_structure.h"
+#include "model/traveling_salesman/common/solve_control.h"
 
 namespace s21 {
 
+// Colonies restart from fresh pheromones. Inside a colony the ants go in
+// iterations of params.ants_per_iteration: they walk concurrently on the
+// same, read-only trails and their deposits are applied together once the
+// iteration is over. Ant i of an iteration always draws from random stream
+// i of params.seed, whichever thread walks it, so a seeded run gives the
+// same tours on any number of threads. Every thread walks its ants with
+// one reusable Ant and copies the tours into buffers kept for
+// the whole run, so an iteration allocates nothing after the first one.
+// What the tours do to the trails is up to the PheromoneUpdateStrategy,
+// the plain Ant System unless another one is given. `control` is looked
+// at after every iteration.
 class AntColony {
  public:
-  const double kPheromoneQuantiy = 15.0;
-  const double kPheromoneEvaporationRate = 0.1;
   const double kPheromonInitialLevel = 1;
 
-  AntColony(Graph &graph, size_t count_colony, size_t size_colony);
-  TsmResult Solve();
+  AntColony(Graph &graph, size_t count_colony, size_t size_colony,
+            const AntColonyParams &params = AntColonyParams{});
+  AntColony(Graph &graph, PheromoneUpdateStrategy &update,
+            size_t count_colony, size_t size_colony,
+            const AntColonyParams &params = AntColonyParams{});
+  // update_ may refer to this colony's own default_update_, which a copy
+  // would go on sharing.
+  AntColony(const AntColony &) = delete;
+  AntColony &operator=(const AntColony &) = delete;
+  TsmResult Solve(const SolveControl &control = SolveControl{});
 
  private:
+  AntSystemUpdate default_update_;
   Graph &graph_;
+  PheromoneUpdateStrategy &update_;
   size_t count_colony_;
   size_t size_colony_;
+  AntColonyParams params_;
+  CsrGraph adjacency_;
   std::vector<Ant> ant_colony{};
-  std::random_device rd_{};
-  std::mt19937 gen_{rd_()};
+  std::vector<TsmResult> tours_{};
+  std::vector<RandomStream> streams_{};
 
-  void CreateAntColony();
+  void CreateAntColony(size_t thread_count, size_t ants_per_iteration);
+  void RunIteration(ThreadPool &pool, const ChoiceInfo &choice_info,
+                    size_t size);
 };
 
 }  // namespace s21
@@ -0,0 +1,68 @@
+#include "choice_info.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace s21 {
+
+ChoiceInfo::ChoiceInfo(const CsrGraph &graph, double alpha, double beta,
+                       size_t candidate_count)
+    : graph_(graph),
+      size_(graph.GetSize()),
+      alpha_(alpha),
+      heuristic_(size_ * size_, 0.0),
+      choice_(size_ * size_, 0.0) {
+  for (size_t from = 0; from < size_; ++from) {
+    for (Arc arc : graph_.GetArcs(from)) {
+      heuristic_[from * size_ + arc.to] =
+          std::pow(1.0 / static_cast<double>(arc.weight), beta);
+    }
+  }
+  BuildCandidates(candidate_count);
+}
+
+void ChoiceInfo::Refresh(const Pheromones &pheromones) {
+  for (size_t from = 0; from < size_; ++from) {
+    for (size_t to : graph_.GetTargets(from)) {
+      RefreshEntry(pheromones, from, to);
+    }
+  }
+  generation_ = pheromones.GetGeneration();
+}
+
+void ChoiceInfo::RefreshDeposits(const Pheromones &pheromones) {
+  if (pheromones.GetGeneration() != generation_) {
+    Refresh(pheromones);
+    return;
+  }
+  for (size_t entry : pheromones.GetDepositedEntries()) {
+    RefreshEntry(pheromones, entry / size_, entry % size_);
+  }
+}
+
+void ChoiceInfo::RefreshEntry(const Pheromones &pheromones, size_t from,
+                              size_t to) {
+  double trail = pheromones.GetRelativeValue(from, to);
+  if (alpha_ != 1.0) trail = std::pow(trail, alpha_);
+  choice_[from * size_ + to] = trail * heuristic_[from * size_ + to];
+}
+
+void ChoiceInfo::BuildCandidates(size_t candidate_count) {
+  candidate_offsets_.assign(1, 0);
+  candidates_.clear();
+  std::vector<Arc> arcs;
+  for (size_t from = 0; from < size_; ++from) {
+    arcs.clear();
+    for (Arc arc : graph_.GetArcs(from)) arcs.push_back(arc);
+    size_t count = std::min(candidate_count, arcs.size());
+    std::partial_sort(arcs.begin(), arcs.begin() + count, arcs.end(),
+                      [](const Arc &lhs, const Arc &rhs) {
+                        return lhs.weight < rhs.weight ||
+                               (lhs.weight == rhs.weight && lhs.to < rhs.to);
+                      });
+    for (size_t i = 0; i < count; ++i) candidates_.push_back(arcs[i].to);
+    candidate_offsets_.push_back(candidates_.size());
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,57 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_CHOICE_INFO_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_CHOICE_INFO_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "libs/s21_span.h"
+#include "model/s21_csr_graph.h"
+#include "pheromone.h"
+
+namespace s21 {
+
+// Everything an ant weighs when it picks the next city. The heuristic
+// eta^beta, with eta = 1 / distance, and the nearest-neighbour candidate
+// lists depend on the graph only and are built once; the products
+// tau^alpha * eta^beta are refreshed after every pheromone update, so a
+// step costs one lookup per city considered. Only ratios of choice values
+// matter to an ant, so they are built from the relative pheromone levels
+// and evaporation leaves them alone. Arcs missing from the graph have a
+// choice value of zero.
+class ChoiceInfo {
+ public:
+  ChoiceInfo(const CsrGraph &graph, double alpha, double beta,
+             size_t candidate_count);
+
+  void Refresh(const Pheromones &pheromones);
+  // Catches up with the deposits of the current pheromone epoch, or does a
+  // full Refresh when the levels have been rescaled since the last one.
+  void RefreshDeposits(const Pheromones &pheromones);
+
+  double GetValue(size_t from, size_t to) const {
+    return choice_[from * size_ + to];
+  }
+  // Up to candidate_count targets of `from`, nearest first.
+  Span<const size_t> GetCandidates(size_t from) const {
+    return Span<const size_t>(candidates_.data() + candidate_offsets_[from],
+                              candidate_offsets_[from + 1] -
+                                  candidate_offsets_[from]);
+  }
+
+ private:
+  const CsrGraph &graph_;
+  size_t size_;
+  double alpha_;
+  size_t generation_ = 0;
+  std::vector<double> heuristic_;
+  std::vector<double> choice_;
+  std::vector<size_t> candidate_offsets_;
+  std::vector<size_t> candidates_;
+
+  void BuildCandidates(size_t candidate_count);
+  void RefreshEntry(const Pheromones &pheromones, size_t from, size_t to);
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_CHOICE_INFO_H_
@@ -1,44 +1,103 @@
 #include "pheromone.h"
 
-#include <iomanip>
+#include <algorithm>
 
 namespace s21 {
 
 Pheromones::Pheromones(size_t size, double initial_level,
                        double evaporation_rate)
-    : pheromones_(std::vector<std::vector<double>>(
-          size, std::vector<double>(size, initial_level))),
+    : size_(size),
+      levels_(size * size, initial_level),
+      stamps_(size * size, 0),
       evaporation_rate_(evaporation_rate) {
-  for (size_t i = 0; i < pheromones_.size(); ++i) {
-    pheromones_[i][i] = 0;
+  for (size_t i = 0; i < size_; ++i) {
+    levels_[i * size_ + i] = 0;
   }
 }
 
 double Pheromones::GetValue(size_t from, size_t to) const {
-  return pheromones_[from][to];
+  return GetRelativeValue(from, to) * scale_;
 }
 
-void Pheromones::Update(const TsmResult &path, double pheromoneQuantiy) {
+double Pheromones::GetRelativeValue(size_t from, size_t to) const {
+  return std::clamp(levels_[from * size_ + to], min_value_ / scale_,
+                    max_value_ / scale_);
+}
+
+void Pheromones::SetValue(size_t from, size_t to, double value) {
+  size_t entry = from * size_ + to;
+  levels_[entry] = std::clamp(value, min_value_, max_value_) / scale_;
+  MarkDeposited(entry);
+}
+
+void Pheromones::Fill(double value) {
+  std::fill(levels_.begin(), levels_.end(), value);
+  for (size_t i = 0; i < size_; ++i) {
+    levels_[i * size_ + i] = 0;
+  }
+  scale_ = 1;
+  ++generation_;
+}
+
+void Pheromones::SetBounds(double min_value, double max_value) {
+  min_value_ = min_value;
+  max_value_ = max_value;
+  ++generation_;
+}
+
+void Pheromones::Deposit(const TsmResult &path, double pheromoneQuantiy) {
   double pheromonAverage = pheromoneQuantiy / path.distance;
   Lay(path.vertices, pheromonAverage);
-  Evapration();
 }
 
-void Pheromones::Lay(std::vector<size_t> path, double pheromonAverage) {
-  for (size_t i = 0; i < path.size() - 1; ++i) {
+void Pheromones::Evaporate() {
+  scale_ *= (1 - evaporation_rate_);
+  if (scale_ < kMinScale) {
+    Rescale();
+  } else if (min_value_ > 0) {
+    // The floor min_value_ / scale_ rises with every evaporation, so each
+    // trail clamped to it has a new relative value.
+    ++generation_;
+  }
+  deposited_.clear();
+  ++epoch_;
+}
+
+Span<const size_t> Pheromones::GetDepositedEntries() const {
+  return Span<const size_t>(deposited_.data(), deposited_.size());
+}
+
+size_t Pheromones::GetGeneration() const { return generation_; }
+
+void Pheromones::Lay(const std::vector<size_t> &path, double pheromonAverage) {
+  double amount = pheromonAverage / scale_;
+  for (size_t i = 0; i + 1 < path.size(); ++i) {
     size_t index_left = path[i];
     size_t index_right = path[i + 1];
-    pheromones_[index_left][index_right] += pheromonAverage;
-    pheromones_[index_right][index_left] += pheromonAverage;
+    AddToEntry(index_left * size_ + index_right, amount);
+    AddToEntry(index_right * size_ + index_left, amount);
+  }
+}
+
+void Pheromones::AddToEntry(size_t entry, double amount) {
+  double level = std::max(levels_[entry], min_value_ / scale_) + amount;
+  levels_[entry] = std::min(level, max_value_ / scale_);
+  MarkDeposited(entry);
+}
+
+void Pheromones::MarkDeposited(size_t entry) {
+  if (stamps_[entry] != epoch_) {
+    stamps_[entry] = epoch_;
+    deposited_.push_back(entry);
   }
 }
 
-void Pheromones::Evapration() {
-  for (size_t i = 0; i < pheromones_.size(); ++i) {
-    for (size_t j = 0; j < pheromones_.size(); ++j) {
-      pheromones_[i][j] *= (1 - evaporation_rate_);
-    }
+void Pheromones::Rescale() {
+  for (double &level : levels_) {
+    level *= scale_;
   }
+  scale_ = 1;
+  ++generation_;
 }
 
 }  // namespace s21
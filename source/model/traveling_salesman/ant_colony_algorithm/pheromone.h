@@ -2,26 +2,69 @@
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_PHEROMONE_H_
 
 #include <cstddef>
+#include <limits>
 #include <vector>
 
+#include "libs/s21_span.h"
 #include "model/traveling_salesman/common/path_structure.h"
 
 namespace s21 {
 
+// Pheromone trails with lazy evaporation. Levels are kept relative to one
+// global scale, trail = level * scale, so evaporating every arc is a single
+// multiplication of the scale and a deposit only touches the arcs of its
+// tour. The levels are folded back into the scale when it gets small
+// enough to cost precision, which happens once every few hundred
+// evaporations at most. Optional bounds clamp every trail when it is read
+// or deposited on, so trails that decay below the minimum never have to
+// be visited.
 class Pheromones {
  public:
   Pheromones(size_t size, double initial_level, double evaporation_rate);
   double GetValue(size_t from, size_t to) const;
-  void Update(const TsmResult &path, double pheromoneQuantiy);
+  // Trail divided by the current scale: the same factor for every arc, so
+  // it can stand in for GetValue wherever only ratios matter.
+  double GetRelativeValue(size_t from, size_t to) const;
+  void SetValue(size_t from, size_t to, double value);
+  // Sets every trail but the diagonal, which stays empty.
+  void Fill(double value);
+  void SetBounds(double min_value, double max_value);
+  // Lays the trail of one tour without evaporating, so the tours of a whole
+  // iteration can be deposited before a single Evaporate.
+  void Deposit(const TsmResult &path, double pheromoneQuantiy);
+  void Evaporate();
+
+  // Entries, from * size + to, deposited on since the last Evaporate; each
+  // is listed once thanks to a per-entry stamp of the epoch it was added
+  // in.
+  Span<const size_t> GetDepositedEntries() const;
+  // Bumped whenever the relative levels are rescaled, filled or clamped to
+  // new bounds, which can change every one of them, and on every
+  // evaporation under a lower bound, which lifts the trails held at it.
+  size_t GetGeneration() const;
 
  private:
-  std::vector<std::vector<double>> pheromones_;
+  // Rescale once the scale drops below this; relative levels then stay
+  // far from overflow even after many deposits.
+  static constexpr double kMinScale = 1e-100;
+
+  size_t size_;
+  std::vector<double> levels_;
+  std::vector<size_t> stamps_;
+  std::vector<size_t> deposited_;
+  double scale_ = 1;
+  double min_value_ = 0;
+  double max_value_ = std::numeric_limits<double>::infinity();
   double evaporation_rate_;
+  size_t epoch_ = 1;
+  size_t generation_ = 0;
 
-  void Evapration();
-  void Lay(std::vector<size_t> path, double pheromonAverage);
+  void Lay(const std::vector<size_t> &path, double pheromonAverage);
+  void AddToEntry(size_t entry, double amount);
+  void MarkDeposited(size_t entry);
+  void Rescale();
 };
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_PHEROMONE_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_PHEROMONE_H_
@@ -0,0 +1,120 @@
+#include "pheromone_update.h"
+
+#include <cmath>
+#include <limits>
+
+namespace s21 {
+
+namespace {
+
+bool IsComplete(const TsmResult &tour) {
+  return !tour.vertices.empty() && std::isfinite(tour.distance);
+}
+
+}  // namespace
+
+AntSystemUpdate::AntSystemUpdate(double quantity, double evaporation_rate)
+    : quantity_(quantity), evaporation_rate_(evaporation_rate) {}
+
+void AntSystemUpdate::Initialize(Pheromones &, size_t) {}
+
+void AntSystemUpdate::Execute(Pheromones &pheromones,
+                              Span<const TsmResult> tours,
+                              const TsmResult &) {
+  for (const TsmResult &tour : tours) {
+    if (IsComplete(tour)) pheromones.Deposit(tour, quantity_);
+  }
+}
+
+// Trails evaporate once per iteration by as much as they would after every
+// one of its ants in turn, so the colony forgets at the same pace whatever
+// the iteration size.
+double AntSystemUpdate::GetEvaporationRate(size_t ants_per_iteration) const {
+  return 1 - std::pow(1 - evaporation_rate_, ants_per_iteration);
+}
+
+MaxMinAntSystemUpdate::MaxMinAntSystemUpdate(double evaporation_rate,
+                                             size_t global_best_period)
+    : evaporation_rate_(evaporation_rate),
+      global_best_period_(global_best_period) {}
+
+void MaxMinAntSystemUpdate::Initialize(Pheromones &, size_t size) {
+  size_ = size;
+  iteration_ = 0;
+  bounded_length_ = std::numeric_limits<double>::infinity();
+}
+
+void MaxMinAntSystemUpdate::Execute(Pheromones &pheromones,
+                                    Span<const TsmResult> tours,
+                                    const TsmResult &best_tour) {
+  if (!IsComplete(best_tour)) return;
+  ++iteration_;
+  if (best_tour.distance < bounded_length_) {
+    bool first = std::isinf(bounded_length_);
+    bounded_length_ = best_tour.distance;
+    double max_value = 1 / (evaporation_rate_ * bounded_length_);
+    pheromones.SetBounds(max_value / (2.0 * size_), max_value);
+    if (first) pheromones.Fill(max_value);
+  }
+
+  const TsmResult *depositor = &best_tour;
+  if (global_best_period_ == 0 || iteration_ % global_best_period_ != 0) {
+    for (const TsmResult &tour : tours) {
+      if (IsComplete(tour) && (depositor == &best_tour ||
+                               tour.distance < depositor->distance)) {
+        depositor = &tour;
+      }
+    }
+  }
+  pheromones.Deposit(*depositor, 1);
+}
+
+double MaxMinAntSystemUpdate::GetEvaporationRate(size_t) const {
+  return evaporation_rate_;
+}
+
+AntColonySystemUpdate::AntColonySystemUpdate(double exploitation,
+                                             double evaporation_rate,
+                                             double local_evaporation_rate)
+    : exploitation_(exploitation),
+      evaporation_rate_(evaporation_rate),
+      local_evaporation_rate_(local_evaporation_rate) {}
+
+void AntColonySystemUpdate::Initialize(Pheromones &, size_t size) {
+  size_ = size;
+  initial_level_ = 0;
+}
+
+void AntColonySystemUpdate::Execute(Pheromones &pheromones,
+                                    Span<const TsmResult> tours,
+                                    const TsmResult &best_tour) {
+  if (!IsComplete(best_tour)) return;
+  if (initial_level_ == 0) {
+    initial_level_ = 1 / (size_ * best_tour.distance);
+    pheromones.Fill(initial_level_);
+  }
+  for (const TsmResult &tour : tours) {
+    if (IsComplete(tour)) {
+      Blend(pheromones, tour, local_evaporation_rate_, initial_level_);
+    }
+  }
+  Blend(pheromones, best_tour, evaporation_rate_, 1 / best_tour.distance);
+}
+
+double AntColonySystemUpdate::GetEvaporationRate(size_t) const { return 0; }
+
+double AntColonySystemUpdate::GetExploitation() const { return exploitation_; }
+
+void AntColonySystemUpdate::Blend(Pheromones &pheromones,
+                                  const TsmResult &tour, double rate,
+                                  double target) {
+  for (size_t i = 0; i + 1 < tour.vertices.size(); ++i) {
+    size_t from = tour.vertices[i];
+    size_t to = tour.vertices[i + 1];
+    double value = (1 - rate) * pheromones.GetValue(from, to) + rate * target;
+    pheromones.SetValue(from, to, value);
+    pheromones.SetValue(to, from, value);
+  }
+}
+
+}  // namespace s21
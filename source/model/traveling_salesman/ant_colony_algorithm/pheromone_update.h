@@ -0,0 +1,108 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_PHEROMONE_UPDATE_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_PHEROMONE_UPDATE_H_
+
+#include <cstddef>
+
+#include "libs/s21_span.h"
+#include "model/traveling_salesman/common/path_structure.h"
+#include "pheromone.h"
+
+namespace s21 {
+
+enum class PheromoneUpdateType {
+  kAntSystem,
+  kMaxMinAntSystem,
+  kAntColonySystem
+};
+
+// How a colony turns the tours of an iteration into pheromone. The colony
+// calls Initialize on the fresh trails of every colony, Execute after
+// every iteration and then evaporates the trails at GetEvaporationRate.
+// Tours that are not complete have an infinite distance.
+class PheromoneUpdateStrategy {
+ public:
+  virtual ~PheromoneUpdateStrategy() = default;
+
+  virtual void Initialize(Pheromones &pheromones, size_t size) = 0;
+  virtual void Execute(Pheromones &pheromones, Span<const TsmResult> tours,
+                       const TsmResult &best_tour) = 0;
+  virtual double GetEvaporationRate(size_t ants_per_iteration) const = 0;
+  // Probability q0 that an ant takes the step with the largest choice value
+  // instead of drawing one; zero for the proportional rule alone.
+  virtual double GetExploitation() const { return 0; }
+};
+
+// Ant System: every complete tour deposits quantity / length. Trails
+// evaporate by `evaporation_rate` per ant, applied once per iteration.
+class AntSystemUpdate : public PheromoneUpdateStrategy {
+ public:
+  explicit AntSystemUpdate(double quantity = 15.0,
+                           double evaporation_rate = 0.1);
+
+  void Initialize(Pheromones &pheromones, size_t size) override;
+  void Execute(Pheromones &pheromones, Span<const TsmResult> tours,
+               const TsmResult &best_tour) override;
+  double GetEvaporationRate(size_t ants_per_iteration) const override;
+
+ private:
+  double quantity_;
+  double evaporation_rate_;
+};
+
+// MAX-MIN Ant System: only the iteration-best tour deposits, or the best
+// so far on every global_best_period-th iteration, and trails stay within
+// [tau_max / (2 n), tau_max] with tau_max = 1 / (rho * best length). The
+// trails start at tau_max once the first tour is known. The rho of 0.02
+// usual for MMAS needs thousands of iterations; 0.2 suits runs of a few
+// hundred like the ones GraphAlgorithms does.
+class MaxMinAntSystemUpdate : public PheromoneUpdateStrategy {
+ public:
+  explicit MaxMinAntSystemUpdate(double evaporation_rate = 0.2,
+                                 size_t global_best_period = 5);
+
+  void Initialize(Pheromones &pheromones, size_t size) override;
+  void Execute(Pheromones &pheromones, Span<const TsmResult> tours,
+               const TsmResult &best_tour) override;
+  double GetEvaporationRate(size_t ants_per_iteration) const override;
+
+ private:
+  double evaporation_rate_;
+  size_t global_best_period_;
+  size_t size_ = 0;
+  size_t iteration_ = 0;
+  double bounded_length_ = 0;
+};
+
+// Ant Colony System: ants exploit the best step with probability q0.
+// Every tour of the iteration wears its arcs towards tau_0 = 1 / (n L),
+// L being the first tour length seen, and only the arcs of the best tour
+// so far are then reinforced, tau = (1 - rho) tau + rho / length. There is
+// no evaporation of the other arcs. The local update runs after the
+// iteration rather than after each step, since the ants of an iteration
+// walk concurrently on read-only trails.
+class AntColonySystemUpdate : public PheromoneUpdateStrategy {
+ public:
+  explicit AntColonySystemUpdate(double exploitation = 0.9,
+                                 double evaporation_rate = 0.1,
+                                 double local_evaporation_rate = 0.1);
+
+  void Initialize(Pheromones &pheromones, size_t size) override;
+  void Execute(Pheromones &pheromones, Span<const TsmResult> tours,
+               const TsmResult &best_tour) override;
+  double GetEvaporationRate(size_t ants_per_iteration) const override;
+  double GetExploitation() const override;
+
+ private:
+  double exploitation_;
+  double evaporation_rate_;
+  double local_evaporation_rate_;
+  size_t size_ = 0;
+  double initial_level_ = 0;
+
+  void Blend(Pheromones &pheromones, const TsmResult &tour, double rate,
+             double target);
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_ANT_COLONY_ALGORITHM_PHEROMONE_UPDATE_H_
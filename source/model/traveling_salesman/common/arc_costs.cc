@@ -0,0 +1,18 @@
+#include "arc_costs.h"
+
+namespace s21 {
+
+ArcCosts::ArcCosts(const Graph &graph)
+    : weights_(graph.GetFlatData()), size_(graph.GetSize()) {
+  double total = 0;
+  for (size_t from = 0; from < size_; ++from) {
+    for (size_t to = 0; to < size_; ++to) {
+      size_t weight = weights_[from * size_ + to];
+      total += weight;
+      if (weight != weights_[to * size_ + from]) symmetric_ = false;
+    }
+  }
+  missing_arc_cost_ = total + 1;
+}
+
+}  // namespace s21
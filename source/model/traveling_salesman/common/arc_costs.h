@@ -0,0 +1,40 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_ARC_COSTS_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_ARC_COSTS_H_
+
+#include <cstddef>
+
+#include "model/s21_graph.h"
+
+namespace s21 {
+
+// Arc costs for the tour improvers, which need every tour to have a
+// length: a missing arc costs more than any whole tour, so a tour that can
+// drop one always gets shorter by doing it.
+class ArcCosts {
+ public:
+  // Keeps a view of the matrix, so `graph` has to outlive it.
+  explicit ArcCosts(const Graph &graph);
+
+  // Zero from a vertex to itself.
+  double Cost(size_t from, size_t to) const {
+    if (from == to) return 0;
+    size_t weight = weights_[from * size_ + to];
+    return weight == 0 ? missing_arc_cost_ : weight;
+  }
+  // The graph's own weight, zero for a missing arc.
+  size_t GetWeight(size_t from, size_t to) const {
+    return weights_[from * size_ + to];
+  }
+  // Whether every arc weighs the same as the one back.
+  bool IsSymmetric() const noexcept { return symmetric_; }
+
+ private:
+  Graph::Row weights_;
+  size_t size_;
+  bool symmetric_{true};
+  double missing_arc_cost_{0};
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_ARC_COSTS_H_
@@ -0,0 +1,448 @@
+#include "local_search.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+namespace {
+
+// Weights are integers, so the sums below are exact and any real gain is
+// at least one; this only absorbs rounding once they get past 2^53.
+const double kMinGain = 1e-9;
+
+// How many t3 the first two levels of a Lin-Kernighan chain try.
+const size_t kBreadth[] = {5, 3};
+
+}  // namespace
+
+LocalSearch::LocalSearch(const Graph &graph, const LocalSearchParams &params)
+    : costs_(graph), params_(params), size_(graph.GetSize()) {
+  BuildNeighbours();
+}
+
+Span<const size_t> LocalSearch::GetNeighbours(size_t vertex) const {
+  if (vertex >= size_) {
+    throw std::out_of_range("Vertex is out of range");
+  }
+  return Span<const size_t>(
+      neighbours_.data() + vertex * params_.neighbour_count,
+      neighbour_counts_[vertex]);
+}
+
+void LocalSearch::BuildNeighbours() {
+  const size_t count = params_.neighbour_count;
+  neighbours_.assign(size_ * count, 0);
+  neighbour_counts_.assign(size_, 0);
+  std::vector<std::pair<size_t, size_t>> arcs;
+  for (size_t from = 0; from < size_; ++from) {
+    arcs.clear();
+    for (size_t to = 0; to < size_; ++to) {
+      size_t weight = costs_.GetWeight(from, to);
+      if (to != from && weight != 0) arcs.emplace_back(weight, to);
+    }
+    size_t kept = std::min(count, arcs.size());
+    std::partial_sort(arcs.begin(), arcs.begin() + kept, arcs.end());
+    for (size_t i = 0; i < kept; ++i) {
+      neighbours_[from * count + i] = arcs[i].second;
+    }
+    neighbour_counts_[from] = kept;
+  }
+}
+
+double LocalSearch::Cost(size_t from, size_t to) const {
+  return costs_.Cost(from, to);
+}
+
+size_t LocalSearch::Next(size_t vertex) const {
+  size_t position = position_[vertex] + 1;
+  return tour_[position == size_ ? 0 : position];
+}
+
+size_t LocalSearch::Previous(size_t vertex) const {
+  size_t position = position_[vertex];
+  return tour_[position == 0 ? size_ - 1 : position - 1];
+}
+
+double LocalSearch::ForwardCost(size_t first, size_t last) const {
+  if (first <= last) return forward_[last] - forward_[first];
+  return forward_[size_] - forward_[first] + forward_[last];
+}
+
+double LocalSearch::BackwardCost(size_t first, size_t last) const {
+  if (first <= last) return backward_[last] - backward_[first];
+  return backward_[size_] - backward_[first] + backward_[last];
+}
+
+void LocalSearch::Recompute() {
+  if (costs_.IsSymmetric()) return;
+  forward_.resize(size_ + 1);
+  backward_.resize(size_ + 1);
+  forward_[0] = backward_[0] = 0;
+  for (size_t i = 0; i < size_; ++i) {
+    size_t from = tour_[i];
+    size_t to = tour_[i + 1 == size_ ? 0 : i + 1];
+    forward_[i + 1] = forward_[i] + Cost(from, to);
+    backward_[i + 1] = backward_[i] + Cost(to, from);
+  }
+}
+
+void LocalSearch::Push(size_t vertex) {
+  if (queued_[vertex]) return;
+  queued_[vertex] = true;
+  queue_[(queue_head_ + queue_size_) % size_] = vertex;
+  ++queue_size_;
+}
+
+bool LocalSearch::Improve(TsmResult &tour) {
+  Load(tour.vertices);
+  if (size_ < 4) return false;
+  double before = cost_;
+  QueueAll();
+  if (Optimize() + kMinGain >= before) return false;
+  tour = GetTour(tour.vertices.front());
+  return true;
+}
+
+void LocalSearch::Load(const std::vector<size_t> &vertices) {
+  if (vertices.size() != size_ + 1 || vertices.front() != vertices.back()) {
+    throw std::invalid_argument("Tour has to visit every vertex once");
+  }
+  tour_.assign(vertices.begin(), vertices.end() - 1);
+  position_.assign(size_, size_);
+  for (size_t i = 0; i < size_; ++i) {
+    if (tour_[i] >= size_ || position_[tour_[i]] != size_) {
+      throw std::invalid_argument("Tour has to visit every vertex once");
+    }
+    position_[tour_[i]] = i;
+  }
+  cost_ = 0;
+  for (size_t i = 0; i < size_; ++i) cost_ += Cost(tour_[i], Next(tour_[i]));
+  Recompute();
+  queue_.resize(size_);
+  queued_.assign(size_, false);
+  queue_head_ = 0;
+  queue_size_ = 0;
+}
+
+void LocalSearch::QueueAll() {
+  for (size_t vertex : tour_) Push(vertex);
+}
+
+double LocalSearch::Optimize() {
+  const bool lin_kernighan =
+      costs_.IsSymmetric() && params_.lin_kernighan_depth > 0;
+  // Don't-look bits: only the cities in the queue are tried, and a city goes
+  // back in when a move changes one of its tour edges.
+  while (queue_size_ > 0) {
+    size_t vertex = queue_[queue_head_];
+    queue_head_ = (queue_head_ + 1) % size_;
+    --queue_size_;
+    queued_[vertex] = false;
+    if (size_ < 4) continue;
+    if ((params_.two_opt && TryTwoOpt(vertex)) ||
+        (params_.or_opt && TryOrOpt(vertex)) ||
+        (lin_kernighan && TryLinKernighan(vertex))) {
+      Push(vertex);
+    }
+  }
+  return cost_;
+}
+
+void LocalSearch::Kick(RandomStream &generator, size_t span) {
+  span = std::min(span, size_ - 1);
+  if (size_ < 4 || span < 3) return;
+  std::uniform_int_distribution<size_t> place(0, size_ - 1);
+  std::uniform_int_distribution<size_t> cut(1, span - 1);
+  const size_t begin = place(generator);
+  size_t first = cut(generator);
+  size_t second = cut(generator);
+  while (second == first) second = cut(generator);
+  if (first > second) std::swap(first, second);
+
+  // B, C and D are the offsets [0, first), [first, second), [second, span)
+  // from `begin`; a and e are the cities on either side of them.
+  auto at = [&](size_t offset) { return tour_[(begin + offset) % size_]; };
+  const size_t a = at(size_ - 1);
+  const size_t e = at(span);
+  const size_t ends[] = {at(0), at(first - 1), at(first), at(second - 1),
+                         at(second), at(span - 1)};
+  cost_ += Cost(a, ends[4]) + Cost(ends[5], ends[2]) + Cost(ends[3], ends[0]) +
+           Cost(ends[1], e) - Cost(a, ends[0]) - Cost(ends[1], ends[2]) -
+           Cost(ends[3], ends[4]) - Cost(ends[5], e);
+
+  buffer_.clear();
+  for (size_t i = second; i < span; ++i) buffer_.push_back(at(i));
+  for (size_t i = first; i < second; ++i) buffer_.push_back(at(i));
+  for (size_t i = 0; i < first; ++i) buffer_.push_back(at(i));
+  for (size_t i = 0; i < span; ++i) {
+    size_t position = (begin + i) % size_;
+    tour_[position] = buffer_[i];
+    position_[buffer_[i]] = position;
+  }
+  Recompute();
+  Push(a);
+  Push(e);
+  for (size_t vertex : ends) Push(vertex);
+}
+
+double LocalSearch::GetCost() const noexcept { return cost_; }
+
+TsmResult LocalSearch::GetTour(size_t first_vertex) const {
+  TsmResult tour;
+  if (first_vertex >= size_) {
+    throw std::out_of_range("Vertex is out of range");
+  }
+  size_t start = position_[first_vertex];
+  tour.vertices.reserve(size_ + 1);
+  tour.vertices.insert(tour.vertices.end(), tour_.begin() + start,
+                       tour_.end());
+  tour.vertices.insert(tour.vertices.end(), tour_.begin(),
+                       tour_.begin() + start);
+  tour.vertices.push_back(first_vertex);
+  tour.distance = 0;
+  for (size_t i = 0; i < size_; ++i) {
+    size_t weight = costs_.GetWeight(tour.vertices[i], tour.vertices[i + 1]);
+    if (weight == 0 && size_ > 1) {
+      tour.distance = std::numeric_limits<double>::infinity();
+      break;
+    }
+    tour.distance += weight;
+  }
+  return tour;
+}
+
+// Replaces the arcs a -> b and c -> d by a -> c and b -> d, walking b..c
+// backwards, with c a near city of a. The mirror move replaces e -> c and
+// p -> a by e -> p and c -> a.
+bool LocalSearch::TryTwoOpt(size_t a) {
+  Span<const size_t> neighbours = GetNeighbours(a);
+  size_t b = Next(a);
+  for (size_t c : neighbours) {
+    if (Cost(a, c) >= Cost(a, b)) break;
+    size_t d = Next(c);
+    if (c == b || d == a) continue;
+    double delta = Cost(a, c) + Cost(b, d) - Cost(a, b) - Cost(c, d);
+    if (!costs_.IsSymmetric()) {
+      delta += BackwardCost(position_[b], position_[c]) -
+               ForwardCost(position_[b], position_[c]);
+    }
+    if (delta < -kMinGain) {
+      cost_ += delta;
+      Reverse(position_[b], position_[c]);
+      for (size_t vertex : {a, b, c, d}) Push(vertex);
+      return true;
+    }
+  }
+
+  size_t p = Previous(a);
+  for (size_t c : neighbours) {
+    if (Cost(a, c) >= Cost(p, a)) break;
+    size_t e = Previous(c);
+    if (c == p || e == a) continue;
+    double delta = Cost(e, p) + Cost(c, a) - Cost(e, c) - Cost(p, a);
+    if (!costs_.IsSymmetric()) {
+      delta += BackwardCost(position_[c], position_[p]) -
+               ForwardCost(position_[c], position_[p]);
+    }
+    if (delta < -kMinGain) {
+      cost_ += delta;
+      Reverse(position_[c], position_[p]);
+      for (size_t vertex : {a, p, c, e}) Push(vertex);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Cuts a chain s1..s2 that starts or ends at `vertex` out from between p
+// and nx and puts it between c and d, next to a near city of either end.
+bool LocalSearch::TryOrOpt(size_t vertex) {
+  for (size_t length = 1;
+       length <= params_.max_segment_length && length + 3 <= size_;
+       ++length) {
+    for (size_t shift : {size_t{0}, length - 1}) {
+      if (shift != 0 && length == 1) break;
+      if (TryOrOptChain((position_[vertex] + size_ - shift) % size_, length)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool LocalSearch::TryOrOptChain(size_t begin, size_t length) {
+  const size_t s1 = tour_[begin];
+  const size_t s2 = tour_[(begin + length - 1) % size_];
+  const size_t p = Previous(s1);
+  const size_t nx = Next(s2);
+  auto inside = [&](size_t vertex) {
+    return (position_[vertex] + size_ - begin) % size_ < length;
+  };
+  double forward = 0;
+  double backward = 0;
+  for (size_t i = 0; i + 1 < length; ++i) {
+    size_t from = tour_[(begin + i) % size_];
+    size_t to = tour_[(begin + i + 1) % size_];
+    forward += Cost(from, to);
+    backward += Cost(to, from);
+  }
+  const double removed = Cost(p, s1) + Cost(s2, nx) - Cost(p, nx);
+
+  for (size_t end : {s1, s2}) {
+    for (size_t x : GetNeighbours(end)) {
+      if (Cost(end, x) >= removed) break;
+      if (inside(x)) continue;
+      for (size_t c : {x, Previous(x)}) {
+        size_t d = Next(c);
+        if (inside(c) || inside(d)) continue;
+        double direct = Cost(c, s1) + Cost(s2, d);
+        double turned = Cost(c, s2) + Cost(s1, d) + backward - forward;
+        double delta = std::min(direct, turned) - Cost(c, d) - removed;
+        if (delta < -kMinGain) {
+          cost_ += delta;
+          Move(begin, length, position_[c], turned < direct);
+          for (size_t vertex : {p, nx, s1, s2, c, d}) Push(vertex);
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+// Starts the chain from the arc t1 - t2 on either side of t1, and keeps
+// whatever prefix of it shortened the tour most.
+bool LocalSearch::TryLinKernighan(size_t t1) {
+  const size_t sides[] = {Next(t1), Previous(t1)};
+  for (size_t t2 : sides) {
+    chain_.clear();
+    chain_gain_ = 0;
+    chain_size_ = 0;
+    Deepen(1, t1, t2, Cost(t1, t2));
+    while (chain_.size() > chain_size_) {
+      const Reversal &last = chain_.back();
+      Apply(Reversal{last.t1, last.t4, last.t3, last.t2});
+      chain_.pop_back();
+    }
+    if (chain_size_ == 0) continue;
+    cost_ -= chain_gain_;
+    for (const Reversal &step : chain_) {
+      for (size_t vertex : {step.t1, step.t2, step.t3, step.t4}) Push(vertex);
+    }
+    return true;
+  }
+  return false;
+}
+
+// `gain` is what the arcs removed so far, t1 - t2 included, weigh more than
+// the ones added. Each step adds t2 - t3 for a near t3 and removes the arc
+// t4 - t3 that makes the reversal close into a tour through t1 - t4. The
+// first levels try a few t3, best lookahead first, and deeper ones only the
+// best. Once a chain has shortened the tour no other branch is tried, it is
+// only followed deeper.
+void LocalSearch::Deepen(size_t depth, size_t t1, size_t t2, double gain) {
+  const size_t breadth = depth <= 2 ? kBreadth[depth - 1] : 1;
+  struct Candidate {
+    size_t t3, t4;
+    double score;
+  };
+  Candidate candidates[5];
+  size_t count = 0;
+
+  const bool forward = Next(t1) == t2;
+  for (size_t t3 : GetNeighbours(t2)) {
+    if (gain - Cost(t2, t3) <= kMinGain) break;
+    if (t3 == Next(t2) || t3 == Previous(t2)) continue;
+    size_t t4 = forward ? Previous(t3) : Next(t3);
+    Candidate candidate{t3, t4, Cost(t4, t3) - Cost(t2, t3)};
+    size_t i = std::min(count, breadth - 1);
+    if (count == breadth && candidate.score <= candidates[i].score) continue;
+    for (; i > 0 && candidates[i - 1].score < candidate.score; --i) {
+      candidates[i] = candidates[i - 1];
+    }
+    candidates[i] = candidate;
+    count = std::min(count + 1, breadth);
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    const auto [t3, t4, score] = candidates[i];
+    chain_.push_back(Reversal{t1, t2, t3, t4});
+    Apply(chain_.back());
+    double next_gain = gain + score;
+    double closed = next_gain - Cost(t4, t1);
+    if (closed > chain_gain_ + kMinGain) {
+      chain_gain_ = closed;
+      chain_size_ = chain_.size();
+    }
+    if (depth < params_.lin_kernighan_depth) {
+      Deepen(depth + 1, t1, t4, next_gain);
+    }
+    if (chain_size_ > 0) return;
+    Apply(Reversal{t1, t4, t3, t2});
+    chain_.pop_back();
+  }
+}
+
+void LocalSearch::Apply(const Reversal &reversal) {
+  if (Next(reversal.t1) == reversal.t2) {
+    Reverse(position_[reversal.t2], position_[reversal.t4]);
+  } else {
+    Reverse(position_[reversal.t4], position_[reversal.t2]);
+  }
+}
+
+void LocalSearch::Reverse(size_t first, size_t last) {
+  size_t length = (last + size_ - first) % size_ + 1;
+  // On a symmetric graph the rest of the tour reversed is the same tour.
+  if (costs_.IsSymmetric() && length * 2 > size_) {
+    std::swap(first, last);
+    first = (first + 1) % size_;
+    last = (last + size_ - 1) % size_;
+    length = size_ - length;
+  }
+  for (size_t i = 0; i < length / 2; ++i) {
+    size_t left = (first + i) % size_;
+    size_t right = (last + size_ - i) % size_;
+    std::swap(tour_[left], tour_[right]);
+    position_[tour_[left]] = left;
+    position_[tour_[right]] = right;
+  }
+  Recompute();
+}
+
+void LocalSearch::Move(size_t first, size_t length, size_t after,
+                       bool reversed) {
+  buffer_.clear();
+  for (size_t i = 0; i < length; ++i) {
+    buffer_.push_back(tour_[(first + i) % size_]);
+  }
+  if (reversed) std::reverse(buffer_.begin(), buffer_.end());
+  auto place = [&](size_t position, size_t vertex) {
+    position %= size_;
+    tour_[position] = vertex;
+    position_[vertex] = position;
+  };
+
+  // Shifts whichever side between the chain and its new place is shorter.
+  size_t ahead = (after + size_ - (first + length - 1)) % size_;
+  size_t behind = size_ - length - ahead;
+  if (ahead <= behind) {
+    for (size_t i = 0; i < ahead; ++i) {
+      place(first + i, tour_[(first + length + i) % size_]);
+    }
+    for (size_t i = 0; i < length; ++i) place(first + ahead + i, buffer_[i]);
+  } else {
+    size_t start = (after + 1) % size_;
+    for (size_t i = behind; i-- > 0;) {
+      place(start + length + i, tour_[(start + i) % size_]);
+    }
+    for (size_t i = 0; i < length; ++i) place(start + i, buffer_[i]);
+  }
+  Recompute();
+}
+
+}  // namespace s21
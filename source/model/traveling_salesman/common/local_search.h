@@ -0,0 +1,123 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_LOCAL_SEARCH_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_LOCAL_SEARCH_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "arc_costs.h"
+#include "libs/s21_random_stream.h"
+#include "libs/s21_span.h"
+#include "model/s21_graph.h"
+#include "path_structure.h"
+
+namespace s21 {
+
+struct LocalSearchParams {
+  // Moves are only tried towards this many nearest cities of each end.
+  size_t neighbour_count{10};
+  // Longest chain of cities an Or-opt move relocates.
+  size_t max_segment_length{3};
+  bool two_opt{true};
+  bool or_opt{true};
+  // Deepest chain of reversals one Lin-Kernighan move may try; zero leaves
+  // them out. They need a symmetric graph and are skipped on others.
+  size_t lin_kernighan_depth{0};
+};
+
+// Improves closed tours with 2-opt (reverse a stretch of the tour) and
+// Or-opt (move a chain of up to three cities elsewhere, either way round)
+// until neither finds a shorter tour. Only the k nearest cities of a city
+// are tried as its new neighbour, and a city whose moves all failed is not
+// looked at again until one of its tour edges changes (don't-look bits), so
+// a pass costs about O(n k) instead of O(n^2). Lin-Kernighan moves go
+// further: they chain reversals while the removed arcs still outweigh the
+// added ones and keep the best prefix of the chain, which covers the
+// sequential 3-opt moves and deeper ones.
+//
+// Directed graphs are fine: reversing a stretch is priced with the arcs in
+// the other direction. A missing arc costs more than any whole tour, so
+// the search also repairs tours that use one when it can.
+class LocalSearch {
+ public:
+  // Keeps a view of the matrix, so `graph` has to outlive the search.
+  explicit LocalSearch(const Graph &graph,
+                       const LocalSearchParams &params = LocalSearchParams{});
+
+  // `tour` lists every vertex once and comes back to its first one, as the
+  // solvers return it; it keeps that first vertex. Returns whether the
+  // tour got shorter. Reuses its buffers, so one LocalSearch per thread.
+  bool Improve(TsmResult &tour);
+
+  // Step by step use for solvers that keep working on one tour: Load it,
+  // queue cities, Optimize, Kick it out of the local optimum and Optimize
+  // again. Costs count a missing arc as more than any tour.
+  void Load(const std::vector<size_t> &vertices);
+  void QueueAll();
+  double Optimize();
+  // Double bridge: three consecutive stretches within `span` cities of a
+  // random place swap their order, B C D -> D C B, which no chain of
+  // reversals undoes. Queues the cities around the cuts.
+  void Kick(RandomStream &generator, size_t span);
+  double GetCost() const noexcept;
+  // The current tour, as a closed TsmResult starting at `first_vertex`.
+  TsmResult GetTour(size_t first_vertex) const;
+
+  Span<const size_t> GetNeighbours(size_t vertex) const;
+
+ private:
+  ArcCosts costs_;
+  LocalSearchParams params_;
+  size_t size_;
+  std::vector<size_t> neighbours_{};
+  std::vector<size_t> neighbour_counts_{};
+
+  // Current tour without the closing vertex, where every city is, and the
+  // cost of the first i arcs walked forwards and backwards.
+  std::vector<size_t> tour_{};
+  std::vector<size_t> position_{};
+  std::vector<double> forward_{};
+  std::vector<double> backward_{};
+  // Ring of the cities still to try; each one is in it at most once.
+  std::vector<size_t> queue_{};
+  std::vector<bool> queued_{};
+  size_t queue_head_{0};
+  size_t queue_size_{0};
+  std::vector<size_t> buffer_{};
+  double cost_{0};
+  // Lin-Kernighan chain being tried: the t1..t4 of every reversal, and the
+  // best gain of closing it with how many of them that keeps.
+  struct Reversal {
+    size_t t1, t2, t3, t4;
+  };
+  std::vector<Reversal> chain_{};
+  double chain_gain_{0};
+  size_t chain_size_{0};
+
+  void BuildNeighbours();
+  double Cost(size_t from, size_t to) const;
+  size_t Next(size_t vertex) const;
+  size_t Previous(size_t vertex) const;
+  // Arcs from position `first` up to position `last`, going forwards or
+  // backwards along them, wrapping around the end of the tour.
+  double ForwardCost(size_t first, size_t last) const;
+  double BackwardCost(size_t first, size_t last) const;
+  void Recompute();
+  void Push(size_t vertex);
+
+  bool TryTwoOpt(size_t vertex);
+  bool TryOrOpt(size_t vertex);
+  bool TryOrOptChain(size_t begin, size_t length);
+  bool TryLinKernighan(size_t vertex);
+  void Deepen(size_t depth, size_t t1, size_t t2, double gain);
+  // Removes t1 - t2 and t4 - t3 and adds t2 - t3 and t1 - t4, where t2 and
+  // t3 follow t1 and t4 in the same direction.
+  void Apply(const Reversal &reversal);
+  // Reverses the tour from position `first` to position `last`.
+  void Reverse(size_t first, size_t last);
+  // Moves the `length` cities from position `first` to just after `after`.
+  void Move(size_t first, size_t length, size_t after, bool reversed);
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_LOCAL_SEARCH_H_
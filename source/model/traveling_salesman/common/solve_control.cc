@@ -0,0 +1,46 @@
+#include "solve_control.h"
+
+#include <limits>
+
+namespace s21 {
+
+void CancellationToken::Cancel() noexcept {
+  cancelled_.store(true, std::memory_order_relaxed);
+}
+
+bool CancellationToken::IsCancelled() const noexcept {
+  return cancelled_.load(std::memory_order_relaxed);
+}
+
+SolveControl SolveControl::WithTimeout(Clock::duration timeout) {
+  SolveControl control;
+  control.deadline = Clock::now() + timeout;
+  return control;
+}
+
+bool SolveControl::IsBounded() const noexcept {
+  return deadline != Clock::time_point::max() || cancellation != nullptr;
+}
+
+bool SolveControl::ShouldStop() const {
+  if (cancellation && cancellation->IsCancelled()) return true;
+  return deadline != Clock::time_point::max() && Clock::now() >= deadline;
+}
+
+ImprovementReporter::ImprovementReporter(const SolveControl &control)
+    : control_(control), best_(std::numeric_limits<double>::infinity()) {}
+
+void ImprovementReporter::Offer(const std::vector<size_t> &vertices,
+                                double distance) {
+  if (!control_.on_improvement || !(distance < best_.load())) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!(distance < best_.load())) return;
+  best_.store(distance);
+  control_.on_improvement(TsmResult{vertices, distance});
+}
+
+void ImprovementReporter::Offer(const TsmResult &tour) {
+  Offer(tour.vertices, tour.distance);
+}
+
+}  // namespace s21
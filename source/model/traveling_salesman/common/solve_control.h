@@ -0,0 +1,72 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_SOLVE_CONTROL_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_SOLVE_CONTROL_H_
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "path_structure.h"
+
+namespace s21 {
+
+enum class TsmAlgorithm {
+  kAntColony,
+  kGeneticAlgorithm,
+  kSimulatedAnnealing,
+  kLinKernighan
+};
+
+// Lets another thread stop a solve early.
+class CancellationToken {
+ public:
+  void Cancel() noexcept;
+  bool IsCancelled() const noexcept;
+
+ private:
+  std::atomic<bool> cancelled_{false};
+};
+
+// When a solver has to give up and whom it tells about better tours. The
+// solvers look at it between their steps (an ant iteration, a generation,
+// a batch of annealing moves, a kick) and return the best tour they have
+// as soon as ShouldStop says so.
+struct SolveControl {
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point deadline{Clock::time_point::max()};
+  // Not owned; may be null.
+  const CancellationToken *cancellation{nullptr};
+  // Gets every complete tour shorter than all it got before. It may be
+  // called from a worker thread, but never by two threads at once.
+  std::function<void(const TsmResult &)> on_improvement{};
+
+  static SolveControl WithTimeout(Clock::duration timeout);
+
+  // Has a deadline or a token, so a solver may run until it is told to
+  // stop instead of for its fixed budget.
+  bool IsBounded() const noexcept;
+  bool ShouldStop() const;
+};
+
+// Passes tours on to SolveControl::on_improvement, keeping only those that
+// are complete and shorter than every one passed before. Safe to call from
+// several threads.
+class ImprovementReporter {
+ public:
+  // Keeps a reference, so `control` has to outlive the reporter.
+  explicit ImprovementReporter(const SolveControl &control);
+
+  void Offer(const std::vector<size_t> &vertices, double distance);
+  void Offer(const TsmResult &tour);
+
+ private:
+  const SolveControl &control_;
+  std::mutex mutex_;
+  std::atomic<double> best_;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_COMMON_SOLVE_CONTROL_H_
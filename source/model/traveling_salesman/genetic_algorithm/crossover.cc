@@ -1,52 +1,49 @@
 #include "crossover.h"
 
 #include <algorithm>
-#include <unordered_set>
-
-#include "chromosome.h"
 
 namespace s21 {
 
-void OrderedCrossover::Execute(Population &population,
-                               double probability_crossing) {
+void CrossoverStrategy::Execute(const Population &parents,
+                                const std::vector<size_t> &selected,
+                                Population &children,
+                                double probability_crossing) {
+  const size_t size = selected.size();
+  if (size == 0) {
+    return;
+  }
+
   std::uniform_real_distribution<double> dist(0.0, 1.0);
-  std::uniform_int_distribution<size_t> dist_int(1, population.GetSize() - 1);
+  std::uniform_int_distribution<size_t> dist_int(
+      1, std::max<size_t>(1, size - 1));
   size_t offset = dist_int(gen_);
 
-  for (size_t i = 0; i < population.GetSize(); i += 1) {
-    if (dist(gen_) < probability_crossing) {
-      Chromosome &parent1 = population.GetChromosome(i);
-      Chromosome &parent2 =
-          population.GetChromosome((i + offset) % population.GetSize());
-      Cross(parent1.genes, parent2.genes);
+  for (size_t i = 0; i < size; ++i) {
+    Span<const size_t> parent1 = parents.GetGenes(selected[i]);
+    Span<size_t> child = children.GetGenes(i);
+    if (size > 1 && dist(gen_) < probability_crossing) {
+      Cross(parent1, parents.GetGenes(selected[(i + offset) % size]), child);
+    } else {
+      std::copy(parent1.begin(), parent1.end(), child.begin());
     }
   }
 }
 
-void OrderedCrossover::Cross(std::vector<size_t> &genes1,
-                             std::vector<size_t> &genes2) {
-  Range range = GenerateRandomRange(genes1.size());
-  if (range.left == range.right) {
-    return;
-  }
-
-  std::vector<size_t> old_genes1(genes1);
-  std::vector<size_t> old_genes2(genes2);
-
-  ExchangeGenes(genes1, genes2, range);
-  InheritGenes(genes1, old_genes1, range);
-  InheritGenes(genes2, old_genes2, range);
+std::unique_ptr<CrossoverStrategy> OrderedCrossover::Clone() const {
+  return std::make_unique<OrderedCrossover>();
 }
 
-void OrderedCrossover::ExchangeGenes(std::vector<size_t> &genes1,
-                                     std::vector<size_t> &genes2,
-                                     const Range &range) {
-  if (genes1.size() != genes2.size()) {
+void OrderedCrossover::Cross(Span<const size_t> parent1,
+                             Span<const size_t> parent2, Span<size_t> child) {
+  Range range = GenerateRandomRange(parent1.Size());
+  if (range.left == range.right) {
+    std::copy(parent1.begin(), parent1.end(), child.begin());
     return;
   }
 
-  std::swap_ranges(genes1.begin() + range.left, genes1.begin() + range.right,
-                   genes2.begin() + range.left);
+  std::copy(parent2.begin() + range.left, parent2.begin() + range.right,
+            child.begin() + range.left);
+  InheritGenes(child, parent1, range);
 }
 
 Range OrderedCrossover::GenerateRandomRange(size_t max_size) {
@@ -61,26 +58,114 @@ Range OrderedCrossover::GenerateRandomRange(size_t max_size) {
   return Range{std::min(point1, point2), std::max(point1, point2)};
 }
 
-void OrderedCrossover::InheritGenes(std::vector<size_t> &new_genes,
-                                    std::vector<size_t> &old_genes,
+void OrderedCrossover::InheritGenes(Span<size_t> child,
+                                    Span<const size_t> parent,
                                     const Range &range) {
+  const size_t size = parent.Size() - 1;
+  in_range_.assign(size, false);
+  for (size_t i = range.left; i < range.right; ++i) {
+    in_range_[child[i]] = true;
+  }
+
   size_t ind_dst = 0;
+  for (size_t i = 0; i < size; ++i) {
+    size_t ind_src = (range.right + i) % size;
+    if (!in_range_[parent[ind_src]]) {
+      child[(ind_dst + range.right) % size] = parent[ind_src];
+      ind_dst += 1;
+    }
+  }
 
-  for (size_t i = 0; i < old_genes.size() - 1; ++i) {
-    size_t ind_src = (range.right + i) % (old_genes.size() - 1);
-    auto it = std::find(new_genes.begin() + range.left,
-                        new_genes.begin() + range.right, old_genes[ind_src]);
+  child[size] = child[0];
+}
 
-    if (it == new_genes.begin() + range.right) {
-      new_genes[(ind_dst + range.right) % (new_genes.size() - 1)] =
-          old_genes[ind_src];
-      ind_dst += 1;
+std::unique_ptr<CrossoverStrategy> EdgeRecombinationCrossover::Clone() const {
+  return std::make_unique<EdgeRecombinationCrossover>();
+}
+
+void EdgeRecombinationCrossover::Cross(Span<const size_t> parent1,
+                                       Span<const size_t> parent2,
+                                       Span<size_t> child) {
+  const size_t size = parent1.Size() - 1;
+  if (size < 3) {
+    std::copy(parent1.begin(), parent1.end(), child.begin());
+    return;
+  }
+
+  neighbours_.resize(size * kMaxNeighbours);
+  counts_.assign(size, 0);
+  AddEdges(parent1, size);
+  AddEdges(parent2, size);
+  unvisited_.resize(size);
+  position_.resize(size);
+  for (size_t i = 0; i < size; ++i) {
+    unvisited_[i] = i;
+    position_[i] = i;
+  }
+
+  size_t current = parent1[0];
+  for (size_t i = 0; i < size; ++i) {
+    child[i] = current;
+    // Swap-remove the city from the unvisited ones and from the lists of
+    // its neighbours.
+    size_t last = unvisited_.back();
+    unvisited_[position_[current]] = last;
+    position_[last] = position_[current];
+    unvisited_.pop_back();
+    const size_t *list = neighbours_.data() + current * kMaxNeighbours;
+    for (size_t j = 0; j < counts_[current]; ++j) {
+      RemoveNeighbour(list[j], current);
+    }
+    if (unvisited_.empty()) break;
+
+    size_t next = size;
+    size_t ties = 0;
+    for (size_t j = 0; j < counts_[current]; ++j) {
+      const size_t candidate = list[j];
+      if (next == size || counts_[candidate] < counts_[next]) {
+        next = candidate;
+        ties = 1;
+      } else if (counts_[candidate] == counts_[next] &&
+                 std::uniform_int_distribution<size_t>(0, ties++)(gen_) == 0) {
+        next = candidate;
+      }
+    }
+    if (next == size) {
+      next = unvisited_[std::uniform_int_distribution<size_t>(
+          0, unvisited_.size() - 1)(gen_)];
     }
+    current = next;
   }
 
-  if (new_genes.front() != new_genes.back()) {
-    new_genes.back() = new_genes.front();
+  child[size] = child[0];
+}
+
+void EdgeRecombinationCrossover::AddEdges(Span<const size_t> parent,
+                                          size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    AddNeighbour(parent[i], parent[(i + 1) % size]);
+    AddNeighbour(parent[(i + 1) % size], parent[i]);
+  }
+}
+
+void EdgeRecombinationCrossover::AddNeighbour(size_t vertex,
+                                              size_t neighbour) {
+  size_t *list = neighbours_.data() + vertex * kMaxNeighbours;
+  if (std::find(list, list + counts_[vertex], neighbour) !=
+      list + counts_[vertex]) {
+    return;
   }
+  list[counts_[vertex]++] = neighbour;
+}
+
+void EdgeRecombinationCrossover::RemoveNeighbour(size_t vertex,
+                                                 size_t neighbour) {
+  size_t *list = neighbours_.data() + vertex * kMaxNeighbours;
+  size_t *end = list + counts_[vertex];
+  size_t *it = std::find(list, end, neighbour);
+  if (it == end) return;
+  *it = *(end - 1);
+  --counts_[vertex];
 }
 
 }  // namespace s21
@@ -1,9 +1,12 @@
 #ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_CROSSOVER_H_
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_CROSSOVER_H_
 
+#include <memory>
 #include <random>
 #include <vector>
 
+#include "libs/s21_random_stream.h"
+#include "libs/s21_span.h"
 #include "population.h"
 
 namespace s21 {
@@ -13,27 +16,77 @@ struct Range {
   size_t right;
 };
 
+// Child i of `children` comes from parents selected[i] and
+// selected[(i + offset) % size], with one random offset per generation.
+// With probability probability_crossing it is their Cross, otherwise a
+// copy of the first parent.
 class CrossoverStrategy {
  public:
-  virtual void Execute(Population &population, double probability_crossing) = 0;
+  virtual ~CrossoverStrategy() = default;
+  // `children` must have the shape of `parents`.
+  virtual void Execute(const Population &parents,
+                       const std::vector<size_t> &selected,
+                       Population &children, double probability_crossing);
+  // Same strategy with its own random stream, for another island.
+  virtual std::unique_ptr<CrossoverStrategy> Clone() const = 0;
+  // Replaces the strategy's random stream, which is seeded from
+  // std::random_device until then.
+  void SetStream(const RandomStream &stream) { gen_ = stream; }
+
+ protected:
+  RandomStream gen_{RandomStream::RandomSeed()};
+
+  // Writes a closed tour made from the closed tours `parent1` and
+  // `parent2` into `child`, all of the same length.
+  virtual void Cross(Span<const size_t> parent1, Span<const size_t> parent2,
+                     Span<size_t> child) = 0;
 };
 
+// The child keeps a random stretch of the second parent where it is and
+// takes the other cities in the order they follow the stretch in the first.
+// Which cities the stretch holds is marked in a table, so a cross is O(n).
 class OrderedCrossover : public CrossoverStrategy {
  public:
-  void Execute(Population &population, double probability_crossing = 0.9);
+  std::unique_ptr<CrossoverStrategy> Clone() const override;
+
+ protected:
+  void Cross(Span<const size_t> parent1, Span<const size_t> parent2,
+             Span<size_t> child) override;
 
  private:
-  std::random_device rd_{};
-  std::mt19937 gen_{rd_()};
+  std::vector<bool> in_range_{};
 
-  void Cross(std::vector<size_t> &genes1, std::vector<size_t> &genes2);
-  void ExchangeGenes(std::vector<size_t> &genes1, std::vector<size_t> &genes2,
-                     const Range &range);
   Range GenerateRandomRange(size_t max_size);
-  void InheritGenes(std::vector<size_t> &new_genes,
-                    std::vector<size_t> &old_genes, const Range &range);
+  void InheritGenes(Span<size_t> child, Span<const size_t> parent,
+                    const Range &range);
+};
+
+// Edge recombination: the child starts where the first parent does and
+// always goes on along an edge of either parent, to the neighbour with the
+// fewest edges left (ties broken at random), and jumps to a random city
+// only when the current one has none. Each city keeps at most four
+// neighbours, so a cross is O(n).
+class EdgeRecombinationCrossover : public CrossoverStrategy {
+ public:
+  std::unique_ptr<CrossoverStrategy> Clone() const override;
+
+ protected:
+  void Cross(Span<const size_t> parent1, Span<const size_t> parent2,
+             Span<size_t> child) override;
+
+ private:
+  static constexpr size_t kMaxNeighbours = 4;
+
+  std::vector<size_t> neighbours_{};
+  std::vector<size_t> counts_{};
+  std::vector<size_t> unvisited_{};
+  std::vector<size_t> position_{};
+
+  void AddEdges(Span<const size_t> parent, size_t size);
+  void AddNeighbour(size_t vertex, size_t neighbour);
+  void RemoveNeighbour(size_t vertex, size_t neighbour);
 };
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_CROSSOVER_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_CROSSOVER_H_
@@ -0,0 +1,252 @@
+#include "edge_assembly_crossover.h"
+
+#include <algorithm>
+
+namespace s21 {
+
+EdgeAssemblyCrossover::EdgeAssemblyCrossover(const Graph &graph,
+                                             size_t neighbour_count)
+    : graph_(graph),
+      costs_(graph),
+      size_(graph.GetSize()),
+      neighbour_count_(std::min(neighbour_count,
+                                size_ == 0 ? size_t{0} : size_ - 1)) {
+  FindNeighbours();
+}
+
+std::unique_ptr<CrossoverStrategy> EdgeAssemblyCrossover::Clone() const {
+  return std::make_unique<EdgeAssemblyCrossover>(graph_, neighbour_count_);
+}
+
+void EdgeAssemblyCrossover::Cross(Span<const size_t> parent1,
+                                  Span<const size_t> parent2,
+                                  Span<size_t> child) {
+  if (size_ < 4 || parent1.Size() != size_ + 1) {
+    std::copy(parent1.begin(), parent1.end(), child.begin());
+    return;
+  }
+
+  LoadParent(parent1, first_);
+  LoadParent(parent2, second_);
+  BuildCycles();
+  child_ = first_;
+  if (!starts_.empty()) {
+    ApplyCycle(
+        std::uniform_int_distribution<size_t>(0, starts_.size() - 1)(gen_));
+    JoinSubtours(LabelSubtours());
+  }
+
+  // Walk the child from where the first parent starts, the way the first
+  // parent goes if it kept that edge.
+  const size_t start = parent1[0];
+  size_t previous = child_[2 * start] == parent1[1] ? child_[2 * start + 1]
+                                                    : child_[2 * start];
+  size_t current = start;
+  for (size_t i = 0; i < size_; ++i) {
+    child[i] = current;
+    size_t next = child_[2 * current] == previous ? child_[2 * current + 1]
+                                                  : child_[2 * current];
+    previous = current;
+    current = next;
+  }
+  child[size_] = start;
+}
+
+double EdgeAssemblyCrossover::Cost(size_t from, size_t to) const {
+  return (costs_.Cost(from, to) + costs_.Cost(to, from)) / 2;
+}
+
+void EdgeAssemblyCrossover::FindNeighbours() {
+  neighbours_.resize(size_ * neighbour_count_);
+  std::vector<size_t> order;
+  for (size_t vertex = 0; vertex < size_; ++vertex) {
+    order.clear();
+    for (size_t other = 0; other < size_; ++other) {
+      if (other != vertex) order.push_back(other);
+    }
+    std::partial_sort(order.begin(), order.begin() + neighbour_count_,
+                      order.end(), [&](size_t lhs, size_t rhs) {
+                        return Cost(vertex, lhs) < Cost(vertex, rhs);
+                      });
+    std::copy(order.begin(), order.begin() + neighbour_count_,
+              neighbours_.begin() + vertex * neighbour_count_);
+  }
+}
+
+void EdgeAssemblyCrossover::LoadParent(Span<const size_t> parent,
+                                       std::vector<size_t> &links) {
+  links.resize(2 * size_);
+  for (size_t i = 0; i < size_; ++i) {
+    const size_t vertex = parent[i];
+    links[2 * vertex] = parent[(i + size_ - 1) % size_];
+    links[2 * vertex + 1] = parent[(i + 1) % size_];
+  }
+}
+
+void EdgeAssemblyCrossover::BuildCycles() {
+  // The AB-graph: the edges of each parent the other one does not have.
+  // Every city has as many of one kind as of the other there.
+  auto shared = [](const std::vector<size_t> &links, size_t from,
+                   size_t to) {
+    return links[2 * from] == to || links[2 * from + 1] == to;
+  };
+  rest_first_.resize(2 * size_);
+  rest_second_.resize(2 * size_);
+  for (size_t vertex = 0; vertex < size_; ++vertex) {
+    for (size_t slot = 0; slot < 2; ++slot) {
+      const size_t a = first_[2 * vertex + slot];
+      const size_t b = second_[2 * vertex + slot];
+      rest_first_[2 * vertex + slot] =
+          shared(second_, vertex, a) ? kNone : a;
+      rest_second_[2 * vertex + slot] = shared(first_, vertex, b) ? kNone : b;
+    }
+  }
+
+  // A walk that takes edges of the two parents in turn can only come back
+  // to its start after an edge of the second one, and then it is closed.
+  cycles_.clear();
+  starts_.clear();
+  for (size_t start = 0; start < size_; ++start) {
+    while (rest_first_[2 * start] != kNone ||
+           rest_first_[2 * start + 1] != kNone) {
+      starts_.push_back(cycles_.size());
+      size_t current = start;
+      do {
+        cycles_.push_back(current);
+        current = TakeEdge(rest_first_, current);
+        cycles_.push_back(current);
+        current = TakeEdge(rest_second_, current);
+      } while (current != start);
+    }
+  }
+}
+
+size_t EdgeAssemblyCrossover::TakeEdge(std::vector<size_t> &links,
+                                       size_t vertex) {
+  size_t slot = 2 * vertex;
+  if (links[slot] == kNone ||
+      (links[slot + 1] != kNone &&
+       std::uniform_int_distribution<int>(0, 1)(gen_) == 1)) {
+    ++slot;
+  }
+  const size_t next = links[slot];
+  links[slot] = kNone;
+  // The same edge seen from its other end.
+  size_t back = 2 * next;
+  if (links[back] != vertex) ++back;
+  links[back] = kNone;
+  return next;
+}
+
+void EdgeAssemblyCrossover::ApplyCycle(size_t cycle) {
+  const size_t begin = starts_[cycle];
+  const size_t end =
+      cycle + 1 < starts_.size() ? starts_[cycle + 1] : cycles_.size();
+  // Every first-parent edge goes before any second-parent edge comes in,
+  // so a city the cycle passes twice always has a free slot.
+  for (size_t i = begin; i < end; i += 2) {
+    Unlink(cycles_[i], cycles_[i + 1]);
+  }
+  for (size_t i = begin + 1; i < end; i += 2) {
+    const size_t next = i + 1 < end ? cycles_[i + 1] : cycles_[begin];
+    Link(cycles_[i], next);
+  }
+}
+
+size_t EdgeAssemblyCrossover::LabelSubtours() {
+  component_.assign(size_, kNone);
+  component_size_.clear();
+  for (size_t vertex = 0; vertex < size_; ++vertex) {
+    if (component_[vertex] != kNone) continue;
+    const size_t label = component_size_.size();
+    component_size_.push_back(0);
+    size_t previous = kNone;
+    size_t current = vertex;
+    do {
+      component_[current] = label;
+      ++component_size_[label];
+      size_t next = child_[2 * current] == previous ? child_[2 * current + 1]
+                                                    : child_[2 * current];
+      previous = current;
+      current = next;
+    } while (current != vertex);
+  }
+  return component_size_.size();
+}
+
+void EdgeAssemblyCrossover::JoinSubtours(size_t count) {
+  for (; count > 1; --count) {
+    size_t smallest = kNone;
+    for (size_t label = 0; label < component_size_.size(); ++label) {
+      if (component_size_[label] != 0 &&
+          (smallest == kNone ||
+           component_size_[label] < component_size_[smallest])) {
+        smallest = label;
+      }
+    }
+
+    members_.clear();
+    for (size_t vertex = 0; vertex < size_; ++vertex) {
+      if (component_[vertex] == smallest) members_.push_back(vertex);
+    }
+
+    // Drop (u, u2) and (v, v2), join u and u2 to v and v2 either way.
+    double best_gain = std::numeric_limits<double>::infinity();
+    size_t best[4] = {kNone, kNone, kNone, kNone};
+    auto consider = [&](size_t u, size_t v) {
+      for (size_t s = 0; s < 2; ++s) {
+        const size_t u2 = child_[2 * u + s];
+        for (size_t t = 0; t < 2; ++t) {
+          const size_t v2 = child_[2 * v + t];
+          const double removed = Cost(u, u2) + Cost(v, v2);
+          const double straight = Cost(u, v) + Cost(u2, v2) - removed;
+          const double crossed = Cost(u, v2) + Cost(u2, v) - removed;
+          if (straight < best_gain) {
+            best_gain = straight;
+            best[0] = u, best[1] = u2, best[2] = v, best[3] = v2;
+          }
+          if (crossed < best_gain) {
+            best_gain = crossed;
+            best[0] = u, best[1] = u2, best[2] = v2, best[3] = v;
+          }
+        }
+      }
+    };
+    for (size_t u : members_) {
+      const size_t *near = neighbours_.data() + u * neighbour_count_;
+      for (size_t i = 0; i < neighbour_count_; ++i) {
+        if (component_[near[i]] != smallest) consider(u, near[i]);
+      }
+    }
+    if (best[0] == kNone) {
+      // No near city outside the subtour, so try all of them.
+      for (size_t v = 0; v < size_; ++v) {
+        if (component_[v] != smallest) consider(members_[0], v);
+      }
+    }
+
+    // best[2] and best[3] are an edge of the other subtour in either order.
+    const size_t other = component_[best[2]];
+    Unlink(best[0], best[1]);
+    Unlink(best[2], best[3]);
+    Link(best[0], best[2]);
+    Link(best[1], best[3]);
+    for (size_t vertex : members_) component_[vertex] = other;
+    component_size_[other] += component_size_[smallest];
+    component_size_[smallest] = 0;
+  }
+}
+
+void EdgeAssemblyCrossover::Unlink(size_t from, size_t to) {
+  size_t slot = child_[2 * from] == to ? 2 * from : 2 * from + 1;
+  child_[slot] = kNone;
+  slot = child_[2 * to] == from ? 2 * to : 2 * to + 1;
+  child_[slot] = kNone;
+}
+
+void EdgeAssemblyCrossover::Link(size_t from, size_t to) {
+  child_[child_[2 * from] == kNone ? 2 * from : 2 * from + 1] = to;
+  child_[child_[2 * to] == kNone ? 2 * to : 2 * to + 1] = from;
+}
+
+}  // namespace s21
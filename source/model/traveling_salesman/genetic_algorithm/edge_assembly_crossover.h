@@ -0,0 +1,77 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_EDGE_ASSEMBLY_CROSSOVER_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_EDGE_ASSEMBLY_CROSSOVER_H_
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "crossover.h"
+#include "libs/s21_span.h"
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/common/arc_costs.h"
+
+namespace s21 {
+
+// Edge assembly crossover (EAX). The edges the parents do not share split
+// into AB-cycles that alternate between an edge of the first parent and
+// one of the second. The child is the first parent with the first-parent
+// edges of one random AB-cycle swapped for its second-parent edges, which
+// leaves every city with two edges but may break the tour into subtours.
+// Those are joined again smallest first, each with the cheapest exchange
+// of two edges that reaches a near city of another subtour.
+//
+// Edges are undirected; on a directed graph an edge costs the mean of its
+// two arcs, and a missing arc costs more than any tour.
+class EdgeAssemblyCrossover : public CrossoverStrategy {
+ public:
+  // Keeps a reference, so `graph` has to outlive the strategy.
+  explicit EdgeAssemblyCrossover(const Graph &graph,
+                                 size_t neighbour_count = 10);
+
+  std::unique_ptr<CrossoverStrategy> Clone() const override;
+
+ protected:
+  void Cross(Span<const size_t> parent1, Span<const size_t> parent2,
+             Span<size_t> child) override;
+
+ private:
+  static constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+  const Graph &graph_;
+  ArcCosts costs_;
+  size_t size_;
+  size_t neighbour_count_;
+  // neighbour_count_ nearest cities of every city, nearest first.
+  std::vector<size_t> neighbours_{};
+
+  // Two slots per city: its neighbours in the first and second parent,
+  // the AB-graph edges not walked yet, and the child being assembled.
+  std::vector<size_t> first_{};
+  std::vector<size_t> second_{};
+  std::vector<size_t> rest_first_{};
+  std::vector<size_t> rest_second_{};
+  std::vector<size_t> child_{};
+  // AB-cycles one after another; cycle i is cycles_[starts_[i]] up to the
+  // next start, first-parent edges from even positions.
+  std::vector<size_t> cycles_{};
+  std::vector<size_t> starts_{};
+  std::vector<size_t> component_{};
+  std::vector<size_t> component_size_{};
+  std::vector<size_t> members_{};
+
+  double Cost(size_t from, size_t to) const;
+  void FindNeighbours();
+  void LoadParent(Span<const size_t> parent, std::vector<size_t> &links);
+  void BuildCycles();
+  size_t TakeEdge(std::vector<size_t> &links, size_t vertex);
+  void ApplyCycle(size_t cycle);
+  size_t LabelSubtours();
+  void JoinSubtours(size_t count);
+  void Unlink(size_t from, size_t to);
+  void Link(size_t from, size_t to);
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_EDGE_ASSEMBLY_CROSSOVER_H_
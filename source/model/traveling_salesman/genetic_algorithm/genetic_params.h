@@ -0,0 +1,41 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_GENETIC_PARAMS_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_GENETIC_PARAMS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace s21 {
+
+enum class CrossoverType {
+  // Order crossover (OX), keeps the relative order of the cities.
+  kOrdered,
+  // Edge recombination (ERX), keeps the edges of the parents.
+  kEdgeRecombination,
+  // Edge assembly (EAX), joins the edges of the parents into short tours.
+  kEdgeAssembly
+};
+
+struct GeneticParams {
+  // Zero means one thread per hardware thread. A single population spreads
+  // its fitness evaluation over them, islands run one per thread.
+  size_t thread_count{0};
+  // Populations of population_size chromosomes that evolve apart and only
+  // trade their best ones, which keeps more diversity than one population.
+  size_t island_count{1};
+  // Every migration_interval generations each island sends copies of its
+  // migrant_count best chromosomes to the next one in a ring, where they
+  // replace the worst.
+  size_t migration_interval{10};
+  size_t migrant_count{2};
+  CrossoverType crossover{CrossoverType::kOrdered};
+  // Near cities edge assembly looks at when it joins subtours.
+  size_t eax_neighbour_count{10};
+  // Runs with the same seed give the same tour whatever thread_count is;
+  // without one the seed is taken from std::random_device.
+  std::optional<uint64_t> seed{};
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_GENETIC_PARAMS_H_
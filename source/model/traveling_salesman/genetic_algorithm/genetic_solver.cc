@@ -1,6 +1,9 @@
 #include "genetic_solver.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
 #include <vector>
 
 namespace s21 {
@@ -8,46 +11,120 @@ namespace s21 {
 GeneticAlgorithmTsp::GeneticAlgorithmTsp(Graph &distances,
                                          SelectionStrategy &selection,
                                          CrossoverStrategy &crossover,
-                                         MutationStrategy &mutation)
+                                         MutationStrategy &mutation,
+                                         const GeneticParams &params)
     : distances_(distances),
       selection_(selection),
       crossover_(crossover),
-      mutation_(mutation) {}
+      mutation_(mutation),
+      params_(params) {}
 
 TsmResult GeneticAlgorithmTsp::Solve(size_t number_generations,
                                      size_t population_size,
                                      double possible_mutation,
-                                     double possible_crossover) {
+                                     double possible_crossover,
+                                     const SolveControl &control) {
   TsmResult min_path;
   min_path.distance = std::numeric_limits<double>::infinity();
   if (distances_.GetSize() == 0) {
     return min_path;
   }
 
-  Population population = CreatePopulation(population_size);
+  std::vector<Island> islands = CreateIslands(population_size);
+  const bool single = islands.size() == 1;
+  // One population splits its fitness over all threads, islands take one
+  // thread each.
+  ThreadPool pool(
+      single ? ThreadPool::ResolveThreadCount(params_.thread_count)
+             : std::min(ThreadPool::ResolveThreadCount(params_.thread_count),
+                        islands.size()));
+  ImprovementReporter reporter(control);
 
   for (size_t i = 0; i < number_generations; ++i) {
-    population.ComputeFitness(distances_);
+    if (single) {
+      islands[0].population.ComputeFitness(distances_, pool);
+    } else {
+      pool.ParallelFor(islands.size(), [&](size_t island) {
+        islands[island].population.ComputeFitness(distances_);
+      });
+      if (i != 0 && i % std::max<size_t>(1, params_.migration_interval) == 0) {
+        Migrate(islands);
+      }
+    }
 
-    const Chromosome &chromosome = population.GetBestChromosome();
-    if (chromosome.genes.size() == (distances_.GetSize() + 1) &&
-        chromosome.distance < min_path.distance) {
-      min_path.vertices = chromosome.genes;
-      min_path.distance = chromosome.distance;
+    for (const Island &island : islands) {
+      const Population &population = island.population;
+      const size_t best = population.GetBestIndex();
+      if (population.GetDistance(best) < min_path.distance) {
+        Span<const size_t> genes = population.GetGenes(best);
+        min_path.vertices.assign(genes.begin(), genes.end());
+        min_path.distance = population.GetDistance(best);
+        reporter.Offer(min_path);
+      }
     }
-    population = selection_.Execute(population);
-    crossover_.Execute(population, possible_crossover);
-    mutation_.Execute(population, possible_mutation);
+
+    pool.ParallelFor(islands.size(), [&](size_t index) {
+      Island &island = islands[index];
+      island.selection->Execute(island.population, island.selected);
+      island.crossover->Execute(island.population, island.selected,
+                                island.next, possible_crossover);
+      island.mutation->Execute(island.next, possible_mutation);
+      std::swap(island.population, island.next);
+    });
+    if (control.ShouldStop()) break;
   }
 
   return min_path;
 }
 
-Population GeneticAlgorithmTsp::CreatePopulation(size_t population_size) const {
+Population GeneticAlgorithmTsp::CreatePopulation(
+    size_t population_size, const RandomStream &stream) const {
   std::vector<size_t> vertices(distances_.GetSize());
   std::generate(vertices.begin(), vertices.end(),
                 [n = 0]() mutable { return n++; });
-  return Population{vertices, population_size};
+  return Population{vertices, population_size, stream};
+}
+
+std::vector<GeneticAlgorithmTsp::Island> GeneticAlgorithmTsp::CreateIslands(
+    size_t population_size) {
+  const size_t count = std::max<size_t>(1, params_.island_count);
+  while (selections_.size() + 1 < count) {
+    selections_.push_back(selection_.Clone());
+    crossovers_.push_back(crossover_.Clone());
+    mutations_.push_back(mutation_.Clone());
+  }
+
+  std::vector<Island> islands;
+  islands.reserve(count);
+  const size_t gene_count = distances_.GetSize() + 1;
+  const uint64_t seed =
+      params_.seed ? *params_.seed : RandomStream::RandomSeed();
+  for (size_t i = 0; i < count; ++i) {
+    RandomStream stream(seed, i);
+    Island island{CreatePopulation(population_size, stream.Split(0)),
+                  Population(population_size, gene_count),
+                  {},
+                  i == 0 ? &selection_ : selections_[i - 1].get(),
+                  i == 0 ? &crossover_ : crossovers_[i - 1].get(),
+                  i == 0 ? &mutation_ : mutations_[i - 1].get()};
+    island.selection->SetStream(stream.Split(1));
+    island.crossover->SetStream(stream.Split(2));
+    island.mutation->SetStream(stream.Split(3));
+    island.selected.reserve(population_size);
+    islands.push_back(std::move(island));
+  }
+  return islands;
+}
+
+void GeneticAlgorithmTsp::Migrate(std::vector<Island> &islands) const {
+  std::vector<std::vector<Chromosome>> migrants;
+  for (const Island &island : islands) {
+    migrants.push_back(
+        island.population.GetBestChromosomes(params_.migrant_count));
+  }
+  for (size_t i = 0; i < islands.size(); ++i) {
+    islands[(i + 1) % islands.size()].population.ReplaceWorst(migrants[i]);
+  }
 }
 
 }  // namespace s21
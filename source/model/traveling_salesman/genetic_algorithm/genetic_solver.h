@@ -1,32 +1,65 @@
 #ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_GENETIC_SOLVER_H_
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_GENETIC_SOLVER_H_
 
+#include <memory>
+#include <vector>
+
 #include "crossover.h"
+#include "genetic_params.h"
+#include "libs/s21_thread_pool.h"
 #include "model/s21_graph.h"
 #include "model/traveling_salesman/common/path_structure.h"
+#include "model/traveling_salesman/common/solve_control.h"
 #include "mutation.h"
 #include "population.h"
 #include "selection.h"
 
 namespace s21 {
 
+// With more than one island every island gets its own population and its
+// own clones of the strategies, the first one the strategies given here,
+// and the islands go through each generation side by side on the threads.
+// Island i draws everything from stream i of params.seed, split once more
+// for its population and each strategy, so what an island does does not
+// depend on which thread runs it.
 class GeneticAlgorithmTsp {
  public:
   GeneticAlgorithmTsp(Graph &distances, SelectionStrategy &selection,
-                      CrossoverStrategy &crossover, MutationStrategy &mutation);
+                      CrossoverStrategy &crossover, MutationStrategy &mutation,
+                      const GeneticParams &params = GeneticParams{});
+  // `control` is looked at after every generation.
   TsmResult Solve(size_t number_generations = 10, size_t population_size = 200,
                   double possible_mutation = 0.01,
-                  double possible_crossover = 0.9);
+                  double possible_crossover = 0.9,
+                  const SolveControl &control = SolveControl{});
 
  private:
+  // `population` is the current generation and `next` the buffer its
+  // children are written to; the two are swapped after each generation.
+  struct Island {
+    Population population;
+    Population next;
+    std::vector<size_t> selected;
+    SelectionStrategy *selection;
+    CrossoverStrategy *crossover;
+    MutationStrategy *mutation;
+  };
+
   Graph &distances_;
   SelectionStrategy &selection_;
   CrossoverStrategy &crossover_;
   MutationStrategy &mutation_;
+  GeneticParams params_;
+  std::vector<std::unique_ptr<SelectionStrategy>> selections_{};
+  std::vector<std::unique_ptr<CrossoverStrategy>> crossovers_{};
+  std::vector<std::unique_ptr<MutationStrategy>> mutations_{};
 
-  Population CreatePopulation(size_t population_size) const;
+  Population CreatePopulation(size_t population_size,
+                              const RandomStream &stream) const;
+  std::vector<Island> CreateIslands(size_t population_size);
+  void Migrate(std::vector<Island> &islands) const;
 };
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_GENETIC_SOLVER_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_GENETIC_SOLVER_H_
@@ -1,5 +1,7 @@
 #include "mutation.h"
 
+#include <utility>
+
 namespace s21 {
 
 void ExchangeMutation::Execute(Population &population,
@@ -8,25 +10,26 @@ void ExchangeMutation::Execute(Population &population,
 
   for (size_t i = 0; i < population.GetSize(); i += 1) {
     if (dist(gen_) < probability_mutation) {
-      Chromosome &chromosome = population.GetChromosome(i);
-      Mutation(chromosome);
+      Mutation(population.GetGenes(i));
     }
   }
 }
 
-void ExchangeMutation::Mutation(Chromosome &chromosome) {
-  std::uniform_int_distribution<int> dist(0, chromosome.genes.size() - 2);
+std::unique_ptr<MutationStrategy> ExchangeMutation::Clone() const {
+  return std::make_unique<ExchangeMutation>();
+}
+
+void ExchangeMutation::Mutation(Span<size_t> genes) {
+  std::uniform_int_distribution<size_t> dist(0, genes.Size() - 2);
 
   size_t point1 = dist(gen_);
   size_t point2 = dist(gen_);
 
   if (point1 != point2) {
-    std::swap(chromosome.genes[point1], chromosome.genes[point2]);
+    std::swap(genes[point1], genes[point2]);
   }
 
-  if (chromosome.genes.front() != chromosome.genes.back()) {
-    chromosome.genes.back() = chromosome.genes.front();
-  }
+  genes[genes.Size() - 1] = genes[0];
 }
 
 }  // namespace s21
@@ -1,26 +1,36 @@
 #ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_MUTATION_H_
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_MUTATION_H_
 
+#include <memory>
 #include <random>
 
+#include "libs/s21_random_stream.h"
+#include "libs/s21_span.h"
 #include "population.h"
 
 namespace s21 {
 
 class MutationStrategy {
  public:
+  virtual ~MutationStrategy() = default;
   virtual void Execute(Population &population, double probability_mutation) = 0;
+  // Same strategy with its own random stream, for another island.
+  virtual std::unique_ptr<MutationStrategy> Clone() const = 0;
+  // Replaces the strategy's random stream, which is seeded from
+  // std::random_device until then.
+  void SetStream(const RandomStream &stream) { gen_ = stream; }
+
+ protected:
+  RandomStream gen_{RandomStream::RandomSeed()};
 };
 
 class ExchangeMutation : public MutationStrategy {
  public:
   void Execute(Population &population, double probability_mutation = 0.01);
+  std::unique_ptr<MutationStrategy> Clone() const override;
 
  private:
-  std::random_device rd_{};
-  std::mt19937 gen_{rd_()};
-
-  void Mutation(Chromosome &chromosome);
+  void Mutation(Span<size_t> genes);
 };
 
 }  // namespace s21
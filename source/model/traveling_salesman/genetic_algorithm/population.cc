@@ -2,73 +2,120 @@
 
 #include <algorithm>
 #include <limits>
-#include <random>
+#include <stdexcept>
 
 namespace s21 {
 
-Population::Population() : populations_() {}
-
 Population::Population(const std::vector<size_t> &vertices,
-                       size_t size_population) {
-  CreatePopulation(vertices, size_population);
+                       size_t size_population, RandomStream gen)
+    : Population(size_population, vertices.size() + 1) {
+  for (size_t i = 0; i < size_; ++i) {
+    Span<size_t> genes = GetGenes(i);
+    std::copy(vertices.begin(), vertices.end(), genes.begin());
+    std::shuffle(genes.begin(), genes.end() - 1, gen);
+    genes[gene_count_ - 1] = genes[0];
+  }
 }
 
-Population::Population(const Population &&other)
-    : populations_(std::move(other.populations_)) {}
+Population::Population(size_t size_population, size_t gene_count)
+    : size_(size_population),
+      gene_count_(gene_count),
+      genes_(size_population * gene_count),
+      distances_(size_population, std::numeric_limits<double>::infinity()) {}
+
+size_t Population::GetSize() const noexcept { return size_; }
 
-Population &Population::operator=(const Population &&other) {
-  if (&other != this) {
-    populations_ = std::move(other.populations_);
+size_t Population::GetGeneCount() const noexcept { return gene_count_; }
+
+Span<size_t> Population::GetGenes(size_t index) {
+  if (index >= size_) {
+    throw std::out_of_range("Index out of range");
   }
 
-  return *this;
+  return Span<size_t>(genes_.data() + index * gene_count_, gene_count_);
 }
 
-size_t Population::GetSize() const { return populations_.size(); }
-
-const Chromosome &Population::GetBestChromosome() const {
-  auto it = std::min_element(
-      populations_.begin(), populations_.end(),
-      [](const Chromosome &chromosome1, const Chromosome &chromosome2) {
-        return chromosome1.distance < chromosome2.distance;
-      });
+Span<const size_t> Population::GetGenes(size_t index) const {
+  if (index >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
 
-  return *it;
+  return Span<const size_t>(genes_.data() + index * gene_count_, gene_count_);
 }
 
-Chromosome &Population::GetChromosome(size_t index) {
-  if (index >= populations_.size()) {
+double Population::GetDistance(size_t index) const {
+  if (index >= size_) {
     throw std::out_of_range("Index out of range");
   }
 
-  return populations_[index];
+  return distances_[index];
+}
+
+size_t Population::GetBestIndex() const {
+  return std::min_element(distances_.begin(), distances_.end()) -
+         distances_.begin();
 }
 
 void Population::ComputeFitness(const Graph &dictances) {
-  for (auto &chromosome : populations_) {
-    chromosome.UpdateDistance(dictances);
+  for (size_t i = 0; i < size_; ++i) {
+    distances_[i] = Distance(dictances, i);
   }
 }
 
-void Population::Clear() { populations_.clear(); }
+void Population::ComputeFitness(const Graph &dictances, ThreadPool &pool) {
+  pool.ParallelFor(size_, [&](size_t index) {
+    distances_[index] = Distance(dictances, index);
+  });
+}
 
-void Population::AddChromosome(Chromosome &&chromosome) {
-  populations_.push_back(std::move(chromosome));
+void Population::ReplaceWorst(const std::vector<Chromosome> &migrants) {
+  std::vector<size_t> order = OrderByDistance();
+  for (size_t i = 0; i < migrants.size() && i < order.size(); ++i) {
+    const size_t worst = order[order.size() - 1 - i];
+    std::copy(migrants[i].genes.begin(), migrants[i].genes.end(),
+              GetGenes(worst).begin());
+    distances_[worst] = migrants[i].distance;
+  }
+}
+
+std::vector<Chromosome> Population::GetBestChromosomes(size_t count) const {
+  std::vector<size_t> order = OrderByDistance();
+  std::vector<Chromosome> best;
+  for (size_t i = 0; i < count && i < order.size(); ++i) {
+    Span<const size_t> genes = GetGenes(order[i]);
+    best.push_back(Chromosome{std::vector<size_t>(genes.begin(), genes.end()),
+                              distances_[order[i]]});
+  }
+  return best;
 }
 
-void Population::CreatePopulation(const std::vector<size_t> &vertices,
-                                  size_t size_population) {
-  std::random_device rd{};
-  std::mt19937 gen{rd()};
-  populations_.reserve(size_population);
-
-  for (size_t i = 0; i < size_population; ++i) {
-    std::vector<size_t> vertices_copy(vertices);
-    std::shuffle(vertices_copy.begin(), vertices_copy.end(), gen);
-    vertices_copy.push_back(vertices_copy.front());
-    populations_.push_back(Chromosome{std::move(vertices_copy),
-                                      std::numeric_limits<double>::infinity()});
+double Population::Distance(const Graph &dictances, size_t index) const {
+  if (gene_count_ < 2) {
+    throw std::invalid_argument("Chromosome size < 2");
   }
+
+  // Genes are vertices of `dictances`, so the matrix is read unchecked.
+  const size_t size = dictances.GetSize();
+  Graph::Row weights = dictances.GetFlatData();
+  const size_t *genes = genes_.data() + index * gene_count_;
+  double distance = 0;
+  for (size_t i = 0; i + 1 < gene_count_; ++i) {
+    size_t weight = weights[genes[i] * size + genes[i + 1]];
+    if (genes[i] != genes[i + 1] && weight == 0) {
+      return std::numeric_limits<double>::infinity();
+    }
+    distance += weight;
+  }
+  return distance;
+}
+
+std::vector<size_t> Population::OrderByDistance() const {
+  std::vector<size_t> order(size_);
+  for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) {
+    return distances_[lhs] < distances_[rhs];
+  });
+  return order;
 }
 
 }  // namespace s21
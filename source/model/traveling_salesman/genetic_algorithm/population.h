@@ -4,34 +4,54 @@
 #include <vector>
 
 #include "chromosome.h"
+#include "libs/s21_random_stream.h"
+#include "libs/s21_span.h"
+#include "libs/s21_thread_pool.h"
 #include "model/s21_graph.h"
 
 namespace s21 {
 
+// Chromosomes stored row by row in one gene matrix, each row a closed tour
+// of GetGeneCount() genes that ends where it starts. The solver keeps two
+// populations of the same shape and writes the children of one into the
+// other, so a generation reuses the same memory.
 class Population {
  public:
-  Population();
-  Population(const std::vector<size_t>& vertices, size_t size_population);
-  Population(const Population& other);
-  Population(const Population&& other);
-
-  Population& operator=(const Population& other);
-  Population& operator=(const Population&& other);
-
-  void AddChromosome(Chromosome&& chromosome);
-  const Chromosome& GetBestChromosome() const;
-  Chromosome& GetChromosome(size_t index);
-  size_t GetSize() const;
-  void Clear();
+  Population() = default;
+  // `size_population` random tours through `vertices`, shuffled with
+  // `gen`.
+  Population(const std::vector<size_t>& vertices, size_t size_population,
+             RandomStream gen = RandomStream(RandomStream::RandomSeed()));
+  // Room for `size_population` chromosomes of `gene_count` genes.
+  Population(size_t size_population, size_t gene_count);
+
+  size_t GetSize() const noexcept;
+  size_t GetGeneCount() const noexcept;
+  Span<size_t> GetGenes(size_t index);
+  Span<const size_t> GetGenes(size_t index) const;
+  // Length as of the last ComputeFitness, infinite when the tour uses a
+  // missing arc.
+  double GetDistance(size_t index) const;
+  size_t GetBestIndex() const;
+
   void ComputeFitness(const Graph& dictances);
+  // Same, with the chromosomes spread over the threads of `pool`.
+  void ComputeFitness(const Graph& dictances, ThreadPool& pool);
+  // Puts copies of `migrants` in place of the worst chromosomes.
+  void ReplaceWorst(const std::vector<Chromosome>& migrants);
+  // Copies of the `count` best chromosomes, best first.
+  std::vector<Chromosome> GetBestChromosomes(size_t count) const;
 
  private:
-  std::vector<Chromosome> populations_;
+  size_t size_{0};
+  size_t gene_count_{0};
+  std::vector<size_t> genes_{};
+  std::vector<double> distances_{};
 
-  void CreatePopulation(const std::vector<size_t>& vertices,
-                        size_t size_population);
+  double Distance(const Graph& dictances, size_t index) const;
+  std::vector<size_t> OrderByDistance() const;
 };
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_POPULATION_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_POPULATION_H_
@@ -4,52 +4,46 @@
 
 namespace s21 {
 
-Population TournamentSelection::Execute(Population &population) {
+void TournamentSelection::Execute(const Population &population,
+                                  std::vector<size_t> &selected) {
+  selected.clear();
   if (population.GetSize() == 0) {
-    return Population{};
+    return;
   }
 
-  Population new_population;
   size_t number_participants =
       std::min(kParticipantCount, population.GetSize() - 1);
-
-  while (new_population.GetSize() < population.GetSize()) {
-    std::set<size_t> participant_indexes = GenerateUniqueRandomNumbers(
-        0, population.GetSize() - 1, number_participants);
-    Chromosome winner = GetWinnerChromosome(population, participant_indexes);
-    new_population.AddChromosome(std::move(winner));
+  while (selected.size() < population.GetSize()) {
+    selected.push_back(GetWinner(population, number_participants));
   }
-
-  return new_population;
 }
 
-Chromosome TournamentSelection::GetWinnerChromosome(
-    Population &population, const std::set<size_t> &participant_indexes) {
-  auto winner =
-      std::min_element(participant_indexes.begin(), participant_indexes.end(),
-                       [&population](const size_t ind1, const size_t ind2) {
-                         return population.GetChromosome(ind1).distance <
-                                population.GetChromosome(ind2).distance;
-                       });
-
-  Chromosome &chromosome = population.GetChromosome(*winner);
-  return Chromosome{chromosome.genes, chromosome.distance};
+std::unique_ptr<SelectionStrategy> TournamentSelection::Clone() const {
+  return std::make_unique<TournamentSelection>();
 }
 
-std::set<size_t> TournamentSelection::GenerateUniqueRandomNumbers(
-    size_t start, size_t end, size_t count) {
-  if (start > end) {
-    throw std::invalid_argument("Start must be less than end");
+size_t TournamentSelection::GetWinner(const Population &population,
+                                      size_t count) {
+  std::uniform_int_distribution<size_t> dist(0, population.GetSize() - 1);
+  size_t participants[kParticipantCount];
+  size_t winner = dist(gen_);
+  if (count == 0) {
+    return winner;
   }
 
-  std::set<size_t> numbers;
-  std::uniform_int_distribution<size_t> dist(start, end);
-  while (numbers.size() < count && numbers.size() < (end - start)) {
+  participants[0] = winner;
+  for (size_t drawn = 1; drawn < count;) {
     size_t index = dist(gen_);
-    numbers.insert(index);
+    if (std::find(participants, participants + drawn, index) !=
+        participants + drawn) {
+      continue;
+    }
+    participants[drawn++] = index;
+    if (population.GetDistance(index) < population.GetDistance(winner)) {
+      winner = index;
+    }
   }
-
-  return numbers;
+  return winner;
 }
 
 }  // namespace s21
@@ -1,9 +1,11 @@
 #ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_SELECTION_H_
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_SELECTION_H_
 
+#include <memory>
 #include <random>
-#include <set>
+#include <vector>
 
+#include "libs/s21_random_stream.h"
 #include "model/s21_graph.h"
 #include "population.h"
 
@@ -11,25 +13,34 @@ namespace s21 {
 
 class SelectionStrategy {
  public:
-  virtual Population Execute(Population &population) = 0;
+  virtual ~SelectionStrategy() = default;
+  // Fills `selected` with population.GetSize() indexes of the chromosomes
+  // that get to be parents; it keeps its capacity between generations.
+  virtual void Execute(const Population &population,
+                       std::vector<size_t> &selected) = 0;
+  // Same strategy with its own random stream, for another island.
+  virtual std::unique_ptr<SelectionStrategy> Clone() const = 0;
+  // Replaces the strategy's random stream, which is seeded from
+  // std::random_device until then.
+  void SetStream(const RandomStream &stream) { gen_ = stream; }
+
+ protected:
+  RandomStream gen_{RandomStream::RandomSeed()};
 };
 
 class TournamentSelection : public SelectionStrategy {
  public:
-  const size_t kParticipantCount = 3;
+  static constexpr size_t kParticipantCount = 3;
 
-  Population Execute(Population &population) override;
+  void Execute(const Population &population,
+               std::vector<size_t> &selected) override;
+  std::unique_ptr<SelectionStrategy> Clone() const override;
 
  private:
-  std::random_device rd_{};
-  std::mt19937 gen_{rd_()};
-
-  std::set<size_t> GenerateUniqueRandomNumbers(size_t start, size_t end,
-                                               size_t count);
-  Chromosome GetWinnerChromosome(Population &population,
-                                 const std::set<size_t> &participant_indexes);
+  // Shortest of `count` distinct chromosomes drawn at random.
+  size_t GetWinner(const Population &population, size_t count);
 };
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_SELECTION_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_GENETIC_ALGORITHM_SELECTION_H_
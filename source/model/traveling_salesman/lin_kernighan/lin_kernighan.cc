@@ -0,0 +1,79 @@
+#include "lin_kernighan.h"
+
+#include <limits>
+
+#include "libs/s21_random_stream.h"
+#include "model/traveling_salesman/common/local_search.h"
+
+namespace s21 {
+
+LinKernighan::LinKernighan(const Graph &graph,
+                           const LinKernighanParams &params)
+    : graph_(graph), params_(params) {}
+
+TsmResult LinKernighan::Solve(const SolveControl &control) {
+  TsmResult result;
+  result.distance = std::numeric_limits<double>::infinity();
+  const size_t size = graph_.GetSize();
+  if (size == 0) {
+    return result;
+  }
+
+  LocalSearchParams search_params;
+  search_params.neighbour_count = params_.neighbour_count;
+  search_params.lin_kernighan_depth = params_.max_depth;
+  LocalSearch search(graph_, search_params);
+  std::vector<size_t> best = NearestNeighbourTour();
+  search.Load(best);
+  search.QueueAll();
+  double best_cost = search.Optimize();
+  TsmResult tour = search.GetTour(0);
+  best = tour.vertices;
+  ImprovementReporter reporter(control);
+  reporter.Offer(tour);
+
+  RandomStream gen(params_.seed ? *params_.seed : RandomStream::RandomSeed());
+  const size_t kicks = params_.kicks == 0 ? size : params_.kicks;
+  for (size_t i = 0; i < kicks && !control.ShouldStop(); ++i) {
+    search.Kick(gen, params_.kick_span);
+    double cost = search.Optimize();
+    if (cost < best_cost) {
+      best_cost = cost;
+      tour = search.GetTour(0);
+      best = tour.vertices;
+      reporter.Offer(tour);
+    } else {
+      search.Load(best);
+    }
+  }
+
+  return search.GetTour(0);
+}
+
+std::vector<size_t> LinKernighan::NearestNeighbourTour() const {
+  const size_t size = graph_.GetSize();
+  std::vector<bool> visited(size, false);
+  std::vector<size_t> tour;
+  tour.reserve(size + 1);
+  size_t current = 0;
+  visited[current] = true;
+  tour.push_back(current);
+  for (size_t step = 1; step < size; ++step) {
+    Graph::Row row = graph_.GetRow(current);
+    size_t next = size;
+    for (size_t to = 0; to < size; ++to) {
+      if (visited[to]) continue;
+      if (next == size || (row[to] != 0 && (row[next] == 0 ||
+                                            row[to] < row[next]))) {
+        next = to;
+      }
+    }
+    visited[next] = true;
+    tour.push_back(next);
+    current = next;
+  }
+  tour.push_back(tour.front());
+  return tour;
+}
+
+}  // namespace s21
@@ -0,0 +1,40 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_LIN_KERNIGHAN_LIN_KERNIGHAN_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_LIN_KERNIGHAN_LIN_KERNIGHAN_H_
+
+#include <vector>
+
+#include "lin_kernighan_params.h"
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/common/path_structure.h"
+#include "model/traveling_salesman/common/solve_control.h"
+
+namespace s21 {
+
+// Chained Lin-Kernighan: a nearest-neighbour tour is brought to a local
+// optimum with 2-opt, Or-opt and Lin-Kernighan moves, then kicked with
+// local double bridges; the tour after each kick is optimized again from
+// the cities around it and kept only when shorter. The tour is an array
+// with the position of every city, so reversals cost the shorter side.
+// Lin-Kernighan moves need a symmetric graph; on directed ones the solver
+// runs with 2-opt and Or-opt only.
+class LinKernighan {
+ public:
+  explicit LinKernighan(
+      const Graph &graph,
+      const LinKernighanParams &params = LinKernighanParams{});
+
+  // `control` is looked at after every kick.
+  TsmResult Solve(const SolveControl &control = SolveControl{});
+
+ private:
+  const Graph &graph_;
+  LinKernighanParams params_;
+
+  // Closed tour that always goes to the nearest unvisited city it has an
+  // arc to, or to any one when there is none.
+  std::vector<size_t> NearestNeighbourTour() const;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_LIN_KERNIGHAN_LIN_KERNIGHAN_H_
@@ -0,0 +1,27 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_LIN_KERNIGHAN_LIN_KERNIGHAN_PARAMS_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_LIN_KERNIGHAN_LIN_KERNIGHAN_PARAMS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace s21 {
+
+struct LinKernighanParams {
+  // Near cities a move may connect a city to.
+  size_t neighbour_count{8};
+  // Longest chain of reversals in one move.
+  size_t max_depth{10};
+  // Double-bridge kicks tried on the best tour; zero means one per city.
+  size_t kicks{0};
+  // The three stretches a kick swaps lie within this many cities, so the
+  // search after it stays local.
+  size_t kick_span{50};
+  // Runs with the same seed give the same tour; without one the seed is
+  // taken from std::random_device.
+  std::optional<uint64_t> seed{};
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_LIN_KERNIGHAN_LIN_KERNIGHAN_PARAMS_H_
@@ -1,25 +1,81 @@
 #ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_ANNEALING_PARAMS_H_
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_ANNEALING_PARAMS_H_
 
+#include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <optional>
 
 namespace s21 {
+
+enum class AnnealingMode {
+  // Independent restarts, each cooling from start_temperature, spread over
+  // the threads.
+  kMultiStart,
+  // Parallel tempering: replicas at fixed temperatures between
+  // start_temperature and coldest_temperature anneal side by side and
+  // neighbouring ones swap their tours every exchange_interval moves.
+  kReplicaExchange
+};
+
+enum class CoolingScheduleType {
+  // Multiplies the temperature by the same factor every move.
+  kExponential,
+  // Lowers the temperature by the same amount every move.
+  kLinear,
+  // Every adaptive_window moves cools faster while more moves are
+  // accepted than wanted and heats up while fewer are; the share wanted
+  // falls geometrically from initial_acceptance to final_acceptance.
+  kAdaptive,
+  // Calls calculate_new_temperature(temperature, t) for moves t = 2, 3, ...
+  kCustom
+};
+
 struct AnnealingParams {
-  const double start_temperature{100};
-  const double min_temperature{std::numeric_limits<double>::min()};
-  const size_t algorithm_reloads{100};
+  CoolingScheduleType schedule{CoolingScheduleType::kExponential};
+  double start_temperature{100};
+  double min_temperature{0.01};
+  // Moves a restart takes to cool from start_temperature down to
+  // min_temperature; the adaptive schedule stops after as many.
+  size_t schedule_length{10000};
+  size_t algorithm_reloads{100};
 
-  const std::function<double(double, size_t)> calculate_new_temperature{
+  double initial_acceptance{0.5};
+  double final_acceptance{0.001};
+  size_t adaptive_window{100};
+
+  std::function<double(double, size_t)> calculate_new_temperature{
       [](double temperature, size_t t) { return temperature / log10(t); }};
 
-  const std::function<double(double, double)> calculate_transition_probability{
+  std::function<double(double, double)> calculate_transition_probability{
       [](double delta_cost, double temperature) {
         return exp(-delta_cost / temperature);
       }};
+
+  // Each limit ends the run early; zero turns it off. The time limit holds
+  // for the whole solve, the others for every restart or replica.
+  std::chrono::milliseconds time_limit{0};
+  size_t max_iterations{0};
+  // Moves without a shorter tour, counted per restart, or over all
+  // replicas in replica-exchange mode.
+  size_t stagnation_limit{0};
+
+  AnnealingMode mode{AnnealingMode::kMultiStart};
+  // Zero means one thread per hardware thread.
+  size_t thread_count{0};
+  // Restart and replica i draw from a stream seeded with (seed, i), so a
+  // seeded run gives the same tour on any number of threads. Without a
+  // seed one is taken from std::random_device.
+  std::optional<uint64_t> seed{};
+
+  size_t replica_count{8};
+  double coldest_temperature{1};
+  size_t exchange_interval{100};
+  size_t exchange_rounds{1000};
 };
 
 }  // namespace s21
 
-#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_ANNEALING_PARAMS_H_
\ No newline at end of file
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_ANNEALING_PARAMS_H_
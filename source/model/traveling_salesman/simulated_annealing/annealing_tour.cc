@@ -0,0 +1,107 @@
+#include "annealing_tour.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace s21 {
+
+AnnealingTour::AnnealingTour(const Graph &graph)
+    : costs_(graph), size_(graph.GetSize()) {}
+
+void AnnealingTour::Assign(const std::vector<size_t> &vertices) {
+  if (vertices.size() != size_ + 1 || vertices.front() != vertices.back()) {
+    throw std::invalid_argument("Tour has to visit every vertex once");
+  }
+  vertices_ = vertices;
+  cost_ = 0;
+  for (size_t i = 0; i < size_; ++i) {
+    cost_ += Cost(vertices_[i], vertices_[i + 1]);
+  }
+}
+
+double AnnealingTour::SwapDelta(size_t first, size_t second) const {
+  const size_t before = vertices_[first - 1];
+  const size_t x = vertices_[first];
+  const size_t y = vertices_[second];
+  const size_t after = vertices_[second + 1];
+  if (second == first + 1) {
+    return Cost(before, y) + Cost(y, x) + Cost(x, after) - Cost(before, x) -
+           Cost(x, y) - Cost(y, after);
+  }
+  const size_t x_next = vertices_[first + 1];
+  const size_t y_previous = vertices_[second - 1];
+  return Cost(before, y) + Cost(y, x_next) + Cost(y_previous, x) +
+         Cost(x, after) - Cost(before, x) - Cost(x, x_next) -
+         Cost(y_previous, y) - Cost(y, after);
+}
+
+void AnnealingTour::Swap(size_t first, size_t second) {
+  cost_ += SwapDelta(first, second);
+  std::swap(vertices_[first], vertices_[second]);
+}
+
+double AnnealingTour::ReverseDelta(size_t first, size_t last) const {
+  double delta = Cost(vertices_[first - 1], vertices_[last]) +
+                 Cost(vertices_[first], vertices_[last + 1]) -
+                 Cost(vertices_[first - 1], vertices_[first]) -
+                 Cost(vertices_[last], vertices_[last + 1]);
+  if (!costs_.IsSymmetric()) {
+    for (size_t i = first; i < last; ++i) {
+      delta += Cost(vertices_[i + 1], vertices_[i]) -
+               Cost(vertices_[i], vertices_[i + 1]);
+    }
+  }
+  return delta;
+}
+
+void AnnealingTour::Reverse(size_t first, size_t last) {
+  cost_ += ReverseDelta(first, last);
+  std::reverse(vertices_.begin() + first, vertices_.begin() + last + 1);
+}
+
+double AnnealingTour::MoveDelta(size_t first, size_t length,
+                                size_t after) const {
+  const size_t last = first + length - 1;
+  const size_t head = vertices_[first];
+  const size_t tail = vertices_[last];
+  return Cost(vertices_[first - 1], vertices_[last + 1]) +
+         Cost(vertices_[after], head) + Cost(tail, vertices_[after + 1]) -
+         Cost(vertices_[first - 1], head) - Cost(tail, vertices_[last + 1]) -
+         Cost(vertices_[after], vertices_[after + 1]);
+}
+
+void AnnealingTour::Move(size_t first, size_t length, size_t after) {
+  cost_ += MoveDelta(first, length, after);
+  auto begin = vertices_.begin();
+  if (after > first) {
+    std::rotate(begin + first, begin + first + length, begin + after + 1);
+  } else {
+    std::rotate(begin + after + 1, begin + first, begin + first + length);
+  }
+}
+
+size_t AnnealingTour::GetSize() const noexcept { return size_; }
+
+double AnnealingTour::GetCost() const noexcept { return cost_; }
+
+const std::vector<size_t> &AnnealingTour::GetVertices() const noexcept {
+  return vertices_;
+}
+
+double AnnealingTour::GetDistance(const std::vector<size_t> &vertices) const {
+  double distance = 0;
+  for (size_t i = 0; i + 1 < vertices.size(); ++i) {
+    if (vertices[i] == vertices[i + 1]) continue;
+    size_t weight = costs_.GetWeight(vertices[i], vertices[i + 1]);
+    if (weight == 0) return std::numeric_limits<double>::infinity();
+    distance += weight;
+  }
+  return distance;
+}
+
+double AnnealingTour::Cost(size_t from, size_t to) const {
+  return costs_.Cost(from, to);
+}
+
+}  // namespace s21
@@ -0,0 +1,56 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_ANNEALING_TOUR_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_ANNEALING_TOUR_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/common/arc_costs.h"
+#include "model/traveling_salesman/common/path_structure.h"
+
+namespace s21 {
+
+// Closed tour the annealer works on. Its first and last vertex stay put and
+// the ones at positions 1..n-1 move. Every move is priced before it is made
+// from the few arcs it changes, O(1), except reversals on directed graphs,
+// which also pay for the arcs they turn round. A missing arc costs more
+// than any tour, so the annealer can walk through tours that use one.
+class AnnealingTour {
+ public:
+  // Keeps a view of the matrix, so `graph` has to outlive the tour.
+  explicit AnnealingTour(const Graph &graph);
+
+  // `vertices` lists every vertex once and comes back to the first one.
+  void Assign(const std::vector<size_t> &vertices);
+
+  // Exchanges the vertices at positions first < second.
+  double SwapDelta(size_t first, size_t second) const;
+  void Swap(size_t first, size_t second);
+  // Reverses the positions first < last.
+  double ReverseDelta(size_t first, size_t last) const;
+  void Reverse(size_t first, size_t last);
+  // Moves the `length` vertices from `first` to just after position
+  // `after`, which is neither one of them nor the one before them.
+  double MoveDelta(size_t first, size_t length, size_t after) const;
+  void Move(size_t first, size_t length, size_t after);
+
+  // Number of vertices, n, so the moving positions are 1..n-1.
+  size_t GetSize() const noexcept;
+  // Length with missing arcs priced as above.
+  double GetCost() const noexcept;
+  const std::vector<size_t> &GetVertices() const noexcept;
+  // Length of `vertices`, infinite when it uses a missing arc.
+  double GetDistance(const std::vector<size_t> &vertices) const;
+
+ private:
+  ArcCosts costs_;
+  size_t size_;
+  std::vector<size_t> vertices_{};
+  double cost_{0};
+
+  double Cost(size_t from, size_t to) const;
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_ANNEALING_TOUR_H_
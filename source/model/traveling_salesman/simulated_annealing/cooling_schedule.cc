@@ -0,0 +1,57 @@
+#include "cooling_schedule.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace s21 {
+
+CoolingSchedule::CoolingSchedule(const AnnealingParams &params)
+    : params_(params), temperature_(params.start_temperature) {
+  const double length = double(std::max<size_t>(1, params_.schedule_length));
+  factor_ = std::pow(params_.min_temperature / params_.start_temperature,
+                     1 / length);
+  decrement_ = (params_.start_temperature - params_.min_temperature) / length;
+}
+
+double CoolingSchedule::GetTemperature() const noexcept {
+  return temperature_;
+}
+
+bool CoolingSchedule::IsFrozen() const noexcept {
+  if (!(temperature_ > params_.min_temperature)) return true;
+  return params_.schedule != CoolingScheduleType::kCustom &&
+         step_ >= params_.schedule_length;
+}
+
+void CoolingSchedule::Step(bool accepted) {
+  ++step_;
+  switch (params_.schedule) {
+    case CoolingScheduleType::kExponential:
+      temperature_ *= factor_;
+      break;
+    case CoolingScheduleType::kLinear:
+      temperature_ = params_.start_temperature - decrement_ * double(step_);
+      break;
+    case CoolingScheduleType::kAdaptive: {
+      if (accepted) ++window_accepted_;
+      const size_t window = std::max<size_t>(1, params_.adaptive_window);
+      if (step_ % window != 0) break;
+      const double progress =
+          double(step_) / double(std::max<size_t>(1, params_.schedule_length));
+      const double wanted =
+          params_.initial_acceptance *
+          std::pow(params_.final_acceptance / params_.initial_acceptance,
+                   progress);
+      const double share = double(window_accepted_) / double(window);
+      temperature_ *= share > wanted ? 0.9 : 1.1;
+      temperature_ = std::min(temperature_, params_.start_temperature);
+      window_accepted_ = 0;
+      break;
+    }
+    case CoolingScheduleType::kCustom:
+      temperature_ = params_.calculate_new_temperature(temperature_, step_ + 1);
+      break;
+  }
+}
+
+}  // namespace s21
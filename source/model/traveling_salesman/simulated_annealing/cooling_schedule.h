@@ -0,0 +1,35 @@
+#ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_COOLING_SCHEDULE_H_
+#define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_COOLING_SCHEDULE_H_
+
+#include <cstddef>
+
+#include "annealing_params.h"
+
+namespace s21 {
+
+// Temperature of one restart, lowered after every move as the schedule in
+// the params says.
+class CoolingSchedule {
+ public:
+  // Keeps a reference, so `params` has to outlive the schedule.
+  explicit CoolingSchedule(const AnnealingParams &params);
+
+  double GetTemperature() const noexcept;
+  // Below min_temperature, or schedule_length moves done for every
+  // schedule but the custom one.
+  bool IsFrozen() const noexcept;
+  // Goes on to the next move; `accepted` tells whether the last one was.
+  void Step(bool accepted);
+
+ private:
+  const AnnealingParams &params_;
+  double temperature_;
+  size_t step_{0};
+  double factor_{1};
+  double decrement_{0};
+  size_t window_accepted_{0};
+};
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_COOLING_SCHEDULE_H_
@@ -1,6 +1,9 @@
 #include "simulated_annealing.h"
 
 #include <algorithm>
+#include <cmath>
+
+#include "cooling_schedule.h"
 
 namespace s21 {
 
@@ -8,93 +11,296 @@ SimulatedAnnealing::SimulatedAnnealing(const Graph &graph,
                                        const AnnealingParams &params)
     : graph_(graph), params_(params) {}
 
-TsmResult SimulatedAnnealing::Solve() const {
+TsmResult SimulatedAnnealing::Solve(const SolveControl &control) {
+  stats_ = AnnealingStats();
   if (graph_.GraphIsEmpty()) {
     return TsmResult();
   }
 
-  TsmResult best_solution = GenInitalPath();
-  for (size_t i = 0; i < params_.algorithm_reloads; ++i) {
-    TsmResult current_solution = GenInitalPath();
-    double temperature = params_.start_temperature;
+  const Clock::time_point start = Clock::now();
+  deadline_ = params_.time_limit.count() > 0 ? start + params_.time_limit
+                                             : Clock::time_point::max();
+  deadline_ = std::min(deadline_, control.deadline);
+  ImprovementReporter reporter(control);
+  control_ = &control;
+  reporter_ = &reporter;
+  seed_ = params_.seed ? *params_.seed : RandomStream::RandomSeed();
+  const bool replicas = params_.mode == AnnealingMode::kReplicaExchange;
+  const size_t tasks =
+      std::max<size_t>(1, replicas ? params_.replica_count
+                                   : params_.algorithm_reloads);
+  ThreadPool pool(
+      std::min(ThreadPool::ResolveThreadCount(params_.thread_count), tasks));
+  AnnealingTour prototype(graph_);
+  Best best = replicas ? SolveReplicaExchange(pool, prototype)
+                       : SolveMultiStart(pool, prototype);
+  stats_.elapsed = Clock::now() - start;
+  control_ = nullptr;
+  reporter_ = nullptr;
+
+  return {best.vertices, prototype.GetDistance(best.vertices)};
+}
+
+const AnnealingStats &SimulatedAnnealing::GetStats() const noexcept {
+  return stats_;
+}
+
+SimulatedAnnealing::Best SimulatedAnnealing::SolveMultiStart(
+    ThreadPool &pool, const AnnealingTour &prototype) {
+  // Thread i runs restarts i, i + threads, ... in one reused tour. Once the
+  // time is up the remaining restarts are skipped, but every thread starts
+  // at least one. With fewer than three cities there is only one tour, and
+  // Anneal never gets to look at the clock, so one restart does.
+  const size_t reloads =
+      prototype.GetSize() < 3 ? 1
+                              : std::max<size_t>(1, params_.algorithm_reloads);
+  const size_t threads = pool.GetThreadCount();
+  std::vector<Best> bests(threads);
+  std::vector<AnnealingStats> stats(threads);
+  pool.ParallelFor(threads, [&](size_t thread) {
+    AnnealingTour tour = prototype;
+    for (size_t reload = thread; reload < reloads; reload += threads) {
+      if (reload != thread && (stats[thread].timed_out || TimeIsUp())) {
+        stats[thread].timed_out = true;
+        break;
+      }
+      RandomStream gen = Stream(reload);
+      tour.Assign(GenInitalPath(gen));
+      const double before = bests[thread].cost;
+      Anneal(tour, gen, reload, bests[thread], stats[thread]);
+      if (bests[thread].cost < before) {
+        const std::vector<size_t> &vertices = bests[thread].vertices;
+        reporter_->Offer(vertices, tour.GetDistance(vertices));
+      }
+    }
+  });
+
+  for (size_t i = 1; i < threads; ++i) bests[0].Merge(bests[i]);
+  for (const AnnealingStats &thread_stats : stats) stats_ += thread_stats;
+  return bests[0];
+}
+
+void SimulatedAnnealing::Anneal(AnnealingTour &tour, RandomStream &gen,
+                                size_t index, Best &best,
+                                AnnealingStats &stats) const {
+  ++stats.runs;
+  best.Offer(tour, index);
+  if (tour.GetSize() < 3) return;
 
-    size_t t = 2;
-    while (temperature > params_.min_temperature) {
-      TsmResult new_solution = RandomSwap(current_solution);
+  CoolingSchedule cooling(params_);
+  double restart_cost = tour.GetCost();
+  size_t stagnation = 0;
+  for (size_t moves = 0; !cooling.IsFrozen(); ++moves) {
+    if (moves == params_.max_iterations && moves != 0) break;
+    if (stagnation == params_.stagnation_limit && stagnation != 0) break;
+    if (moves % 1024 == 0 && TimeIsUp()) {
+      stats.timed_out = true;
+      break;
+    }
+
+    bool accepted = RandomMove(tour, cooling.GetTemperature(), gen);
+    ++stats.iterations;
+    if (accepted) ++stats.accepted;
+    if (tour.GetCost() < restart_cost) {
+      restart_cost = tour.GetCost();
+      stagnation = 0;
+      best.Offer(tour, index);
+    } else {
+      ++stagnation;
+    }
+    cooling.Step(accepted);
+  }
+}
 
-      double delta_cost = new_solution.distance - current_solution.distance;
+SimulatedAnnealing::Best SimulatedAnnealing::SolveReplicaExchange(
+    ThreadPool &pool, const AnnealingTour &prototype) {
+  const size_t count = std::max<size_t>(1, params_.replica_count);
+  // Level 0 is the hottest; the ladder is geometric, so neighbouring
+  // levels accept each other's tours about equally often all the way down.
+  std::vector<double> temperatures(count);
+  for (size_t level = 0; level < count; ++level) {
+    double share = count > 1 ? double(level) / double(count - 1) : 1;
+    temperatures[level] =
+        params_.start_temperature *
+        std::pow(params_.coldest_temperature / params_.start_temperature,
+                 share);
+  }
+
+  // Replicas keep their tour and stream; exchanges swap which replica
+  // runs at which level.
+  std::vector<AnnealingTour> tours(count, prototype);
+  std::vector<RandomStream> streams;
+  std::vector<Best> bests(count);
+  std::vector<AnnealingStats> stats(count);
+  std::vector<size_t> replica_at(count);
+  for (size_t replica = 0; replica < count; ++replica) {
+    streams.push_back(Stream(replica));
+    tours[replica].Assign(GenInitalPath(streams[replica]));
+    bests[replica].Offer(tours[replica], replica);
+    stats[replica].runs = 1;
+    replica_at[replica] = replica;
+  }
+  RandomStream exchange_gen = Stream(count);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
 
-      if (AcceptSolution(delta_cost, temperature)) {
-        current_solution = new_solution;
-        if (current_solution.distance < best_solution.distance) {
-          best_solution = current_solution;
+  size_t moves = 0;
+  size_t stagnation = 0;
+  bool stopped = tours[0].GetSize() < 3;
+  for (size_t round = 0; round < params_.exchange_rounds && !stopped;
+       ++round) {
+    size_t interval = params_.exchange_interval;
+    if (params_.max_iterations != 0) {
+      interval = std::min(interval, params_.max_iterations - moves);
+    }
+    std::vector<double> costs(count);
+    for (size_t i = 0; i < count; ++i) costs[i] = bests[i].cost;
+    pool.ParallelFor(count, [&](size_t level) {
+      const size_t replica = replica_at[level];
+      for (size_t i = 0; i < interval; ++i) {
+        if (i % 1024 == 0 && TimeIsUp()) {
+          stats[replica].timed_out = true;
+          break;
         }
+        bool accepted =
+            RandomMove(tours[replica], temperatures[level], streams[replica]);
+        ++stats[replica].iterations;
+        if (accepted) ++stats[replica].accepted;
+        bests[replica].Offer(tours[replica], replica);
+      }
+    });
+    moves += interval;
+
+    bool improved = false;
+    for (size_t i = 0; i < count; ++i) {
+      if (bests[i].cost < costs[i]) {
+        improved = true;
+        reporter_->Offer(bests[i].vertices,
+                         prototype.GetDistance(bests[i].vertices));
       }
+      stopped = stopped || stats[i].timed_out;
+    }
+    stagnation = improved ? 0 : stagnation + interval;
+    stopped = stopped || moves == params_.max_iterations ||
+              (params_.stagnation_limit != 0 &&
+               stagnation >= params_.stagnation_limit);
 
-      temperature = params_.calculate_new_temperature(temperature, t);
-      ++t;
+    // Even rounds pair levels (0, 1), (2, 3), ..., odd ones (1, 2), ...
+    for (size_t level = round % 2; level + 1 < count; level += 2) {
+      const size_t hot = replica_at[level];
+      const size_t cold = replica_at[level + 1];
+      double exponent =
+          (1 / temperatures[level] - 1 / temperatures[level + 1]) *
+          (tours[hot].GetCost() - tours[cold].GetCost());
+      ++stats[0].exchanges;
+      if (exponent >= 0 || unit(exchange_gen) < std::exp(exponent)) {
+        std::swap(replica_at[level], replica_at[level + 1]);
+        ++stats[0].accepted_exchanges;
+      }
     }
   }
 
-  return best_solution;
+  for (size_t i = 1; i < count; ++i) bests[0].Merge(bests[i]);
+  for (const AnnealingStats &replica_stats : stats) stats_ += replica_stats;
+  return bests[0];
 }
 
-TsmResult SimulatedAnnealing::GenInitalPath() const {
-  std::vector<size_t> path;
-  for (size_t i = 0; i < graph_.GetSize(); ++i) {
-    path.push_back(i);
+void SimulatedAnnealing::Best::Offer(const AnnealingTour &tour,
+                                     size_t index) {
+  if (tour.GetCost() < cost) {
+    cost = tour.GetCost();
+    this->index = index;
+    vertices = tour.GetVertices();
   }
+}
 
-  std::shuffle(path.begin(), path.end(), random_generator_);
-  path.push_back(*path.begin());
+void SimulatedAnnealing::Best::Merge(const Best &other) {
+  if (other.cost < cost || (other.cost == cost && other.index < index)) {
+    *this = other;
+  }
+}
 
-  return {path, CalculateTotalDistance(path)};
+bool SimulatedAnnealing::TimeIsUp() const {
+  if (control_->cancellation && control_->cancellation->IsCancelled()) {
+    return true;
+  }
+  return deadline_ != Clock::time_point::max() && Clock::now() >= deadline_;
 }
 
-double SimulatedAnnealing::CalculateTotalDistance(
-    const std::vector<size_t> &path) const {
-  double distance = 0;
+RandomStream SimulatedAnnealing::Stream(size_t index) const {
+  return RandomStream(seed_, index);
+}
 
-  for (size_t i = 0; i < path.size() - 1; i++) {
-    size_t currentVertex = path[i];
-    size_t nextVertex = path[i + 1];
-    if (graph_.GetValue(currentVertex, nextVertex) == 0 &&
-        currentVertex != nextVertex) {
-      distance = std::numeric_limits<double>::infinity();
-      break;
-    }
-    distance += graph_.GetValue(currentVertex, nextVertex);
+std::vector<size_t> SimulatedAnnealing::GenInitalPath(
+    RandomStream &gen) const {
+  std::vector<size_t> path;
+  for (size_t i = 0; i < graph_.GetSize(); ++i) {
+    path.push_back(i);
   }
 
-  return distance;
+  std::shuffle(path.begin(), path.end(), gen);
+  path.push_back(*path.begin());
+
+  return path;
 }
 
-bool SimulatedAnnealing::AcceptSolution(double delta_cost,
-                                        double temperature) const {
+bool SimulatedAnnealing::AcceptSolution(double delta_cost, double temperature,
+                                        RandomStream &gen) const {
   if (delta_cost < 0) {
     return true;
   } else {
     double probability =
         params_.calculate_transition_probability(delta_cost, temperature);
     std::uniform_real_distribution<double> distribution(0.0, 1.0);
-    return distribution(random_generator_) < probability;
+    return distribution(gen) < probability;
   }
 }
 
-TsmResult SimulatedAnnealing::RandomSwap(const TsmResult &solution) const {
-  TsmResult new_solution = solution;
-
-  if (new_solution.vertices.size() > 2) {
-    std::uniform_int_distribution<size_t> distribution(
-        1, new_solution.vertices.size() - 2);
-    size_t index1 = distribution(random_generator_);
-    size_t index2 = distribution(random_generator_);
+bool SimulatedAnnealing::RandomMove(AnnealingTour &tour, double temperature,
+                                    RandomStream &gen) const {
+  // Positions 1..n-1 move; the first and last one hold the start vertex.
+  const size_t size = tour.GetSize();
+  if (size < 3) {
+    return false;
+  }
 
-    std::swap(new_solution.vertices[index1], new_solution.vertices[index2]);
+  std::uniform_int_distribution<size_t> kind(0, 2);
+  std::uniform_int_distribution<size_t> position(1, size - 1);
+  size_t move = kind(gen);
+  size_t first = position(gen);
+  if (move < 2) {
+    size_t second = position(gen);
+    while (second == first) second = position(gen);
+    if (first > second) std::swap(first, second);
+    bool swap = move == 0;
+    double delta = swap ? tour.SwapDelta(first, second)
+                        : tour.ReverseDelta(first, second);
+    if (!AcceptSolution(delta, temperature, gen)) return false;
+    swap ? tour.Swap(first, second) : tour.Reverse(first, second);
+    return true;
   }
 
-  new_solution.distance = CalculateTotalDistance(new_solution.vertices);
+  // A chain of one to three vertices goes after any position but its own.
+  std::uniform_int_distribution<size_t> chain(1,
+                                              std::min<size_t>(3, size - 2));
+  size_t length = chain(gen);
+  first = std::uniform_int_distribution<size_t>(1, size - length)(gen);
+  size_t after =
+      std::uniform_int_distribution<size_t>(0, size - length - 2)(gen);
+  if (after >= first - 1) after += length + 1;
+  double delta = tour.MoveDelta(first, length, after);
+  if (!AcceptSolution(delta, temperature, gen)) return false;
+  tour.Move(first, length, after);
+  return true;
+}
 
-  return new_solution;
+AnnealingStats &AnnealingStats::operator+=(const AnnealingStats &other) {
+  iterations += other.iterations;
+  accepted += other.accepted;
+  runs += other.runs;
+  exchanges += other.exchanges;
+  accepted_exchanges += other.accepted_exchanges;
+  timed_out = timed_out || other.timed_out;
+  return *this;
 }
-}  // namespace s21
\ No newline at end of file
+
+}  // namespace s21
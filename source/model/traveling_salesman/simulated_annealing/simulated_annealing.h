@@ -1,30 +1,88 @@
 #ifndef SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_SIMULATED_ANNEALING_H_
 #define SIMPLE_NAVIGATOR_SOURCE_MODEL_TRAVELING_SALESMAN_SIMULATED_ANNEALING_SIMULATED_ANNEALING_H_
 
+#include <chrono>
 #include <random>
+#include <vector>
 
 #include "annealing_params.h"
+#include "annealing_tour.h"
+#include "libs/s21_random_stream.h"
+#include "libs/s21_thread_pool.h"
 #include "model/s21_graph.h"
 #include "model/traveling_salesman/common/path_structure.h"
+#include "model/traveling_salesman/common/solve_control.h"
 
 namespace s21 {
 
+struct AnnealingStats {
+  // Moves proposed and carried out over all restarts or replicas.
+  size_t iterations{0};
+  size_t accepted{0};
+  // Restarts or replicas that ran.
+  size_t runs{0};
+  // Replica exchanges tried and made.
+  size_t exchanges{0};
+  size_t accepted_exchanges{0};
+  // The time limit, the deadline or a cancellation ended the run.
+  bool timed_out{false};
+  std::chrono::duration<double> elapsed{0};
+
+  AnnealingStats &operator+=(const AnnealingStats &other);
+};
+
+// Every step proposes one random move, a swap of two cities, a reversal or
+// moving a chain of up to three cities elsewhere, prices it from the arcs
+// it changes and only carries it out when it is accepted. The restarts, or
+// the replicas in replica-exchange mode, run on a thread pool with a tour
+// and a random stream each, and the shortest tour any of them saw wins.
 class SimulatedAnnealing {
  public:
   SimulatedAnnealing(const Graph &graph, const AnnealingParams &params);
 
-  TsmResult Solve() const;
+  // `control` is looked at every 1024 moves of each restart or replica.
+  TsmResult Solve(const SolveControl &control = SolveControl{});
+  // Counts of the last Solve.
+  const AnnealingStats &GetStats() const noexcept;
 
  private:
-  TsmResult GenInitalPath() const;
-  double CalculateTotalDistance(const std::vector<size_t> &path) const;
-  bool AcceptSolution(double delta_cost, double temperature) const;
-  TsmResult RandomSwap(const TsmResult &solution) const;
+  using Clock = std::chrono::steady_clock;
+
+  // Shortest tour a restart or replica has seen; ties go to the lowest
+  // index, so the reduction does not depend on the thread count.
+  struct Best {
+    double cost{std::numeric_limits<double>::infinity()};
+    size_t index{0};
+    std::vector<size_t> vertices{};
+
+    void Offer(const AnnealingTour &tour, size_t index);
+    void Merge(const Best &other);
+  };
+
+  Best SolveMultiStart(ThreadPool &pool, const AnnealingTour &prototype);
+  Best SolveReplicaExchange(ThreadPool &pool,
+                            const AnnealingTour &prototype);
+
+  // Cools one restart from the tour it holds until the schedule or a limit
+  // stops it.
+  void Anneal(AnnealingTour &tour, RandomStream &gen, size_t index,
+              Best &best, AnnealingStats &stats) const;
+  bool TimeIsUp() const;
+  RandomStream Stream(size_t index) const;
+  std::vector<size_t> GenInitalPath(RandomStream &gen) const;
+  bool AcceptSolution(double delta_cost, double temperature,
+                      RandomStream &gen) const;
+  // Returns whether the move was made.
+  bool RandomMove(AnnealingTour &tour, double temperature,
+                  RandomStream &gen) const;
 
   Graph graph_;
   AnnealingParams params_;
-  std::random_device rd_;
-  mutable std::mt19937 random_generator_{rd_()};
+  uint64_t seed_{0};
+  Clock::time_point deadline_{Clock::time_point::max()};
+  const SolveControl *control_{nullptr};
+  ImprovementReporter *reporter_{nullptr};
+  AnnealingStats stats_{};
 };
 
 }  // namespace s21
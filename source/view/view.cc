@@ -40,9 +40,12 @@ void View::Start() {
           SolveTravelingSalesmanProblem(AlgoritmSolveTSM::kSimulatedAnnealing);
           break;
         case 10:
-          CompareMethodsSolvingTravelingSalesmanProblem();
+          SolveTravelingSalesmanProblem(AlgoritmSolveTSM::kLinKernighan);
           break;
         case 11:
+          CompareMethodsSolvingTravelingSalesmanProblem();
+          break;
+        case 12:
           quit_not_activated = false;
           break;
         default:
@@ -92,9 +95,15 @@ void View::GetShortestPathBetweenVertices() {
     std::cout << "Input finish vertex\n";
     size_t finish_vertex = InputNumber();
 
-    size_t result =
-        controller_.GetShortestPathBetweenVertices(start_vertex, finish_vertex);
-    std::cout << result << std::endl;
+    RouteResult result = controller_.GetShortestRouteBetweenVertices(
+        start_vertex, finish_vertex);
+    if (result.vertices.empty()) {
+      std::cout << "No path between these vertices" << std::endl;
+    } else {
+      std::cout << "Path: ";
+      PrintVector(result.vertices);
+      std::cout << "Distance: " << result.distance << std::endl;
+    }
   } catch (const std::exception &ex) {
     std::cout << "Incorrect number of vertex! Try again!\n";
   }
@@ -119,7 +128,7 @@ void View::SolveTravelingSalesmanProblem(AlgoritmSolveTSM type) {
     return;
   }
 
-  TsmResult result;
+  TsmResult result{};
   switch (type) {
     case AlgoritmSolveTSM::kAntColony:
       result = controller_.SolveTravelingSalesmanProblem();
@@ -130,6 +139,9 @@ void View::SolveTravelingSalesmanProblem(AlgoritmSolveTSM type) {
     case AlgoritmSolveTSM::kSimulatedAnnealing:
       result = controller_.SolveTravelingSalesmanProblemSimulatedAnnealing();
       break;
+    case AlgoritmSolveTSM::kLinKernighan:
+      result = controller_.SolveTravelingSalesmanProblemLinKernighan();
+      break;
   }
 
   if (std::isinf(result.distance)) {
@@ -158,6 +170,8 @@ void View::CompareMethodsSolvingTravelingSalesmanProblem() {
         MeasureTime(AlgoritmSolveTSM::kGenetic, number);
     std::chrono::milliseconds time_simulated_annealing =
         MeasureTime(AlgoritmSolveTSM::kSimulatedAnnealing, number);
+    std::chrono::milliseconds time_lin_kernighan =
+        MeasureTime(AlgoritmSolveTSM::kLinKernighan, number);
 
     std::cout << "Running time algorithms: " << std::endl;
     std::cout << "Ant colony: " << time_ant_colony.count() << " ms"
@@ -165,6 +179,8 @@ void View::CompareMethodsSolvingTravelingSalesmanProblem() {
     std::cout << "Genetic:    " << time_genetic.count() << " ms" << std::endl;
     std::cout << "Simulated annealing:    " << time_simulated_annealing.count()
               << " ms" << std::endl;
+    std::cout << "Lin-Kernighan:    " << time_lin_kernighan.count() << " ms"
+              << std::endl;
   } catch (const std::exception &ex) {
     std::cout << ex.what() << std::endl;
   }
@@ -186,9 +202,12 @@ void View::Menu() {
   std::cout << "9) Solve traveling salesman problem using a simulated "
                "annealing algorithm"
             << std::endl;
-  std::cout << "10) Compare methods for solving the traveling salesman problem"
+  std::cout << "10) Solve traveling salesman problem using the Lin-Kernighan "
+               "heuristic"
             << std::endl;
-  std::cout << "11) Quit" << std::endl;
+  std::cout << "11) Compare methods for solving the traveling salesman problem"
+            << std::endl;
+  std::cout << "12) Quit" << std::endl;
   std::cout << "_____________________________________________\n";
 }
 
@@ -235,6 +254,9 @@ std::chrono::milliseconds View::MeasureTime(AlgoritmSolveTSM algorithm,
       case AlgoritmSolveTSM::kSimulatedAnnealing:
         controller_.SolveTravelingSalesmanProblemSimulatedAnnealing();
         break;
+      case AlgoritmSolveTSM::kLinKernighan:
+        controller_.SolveTravelingSalesmanProblemLinKernighan();
+        break;
       default:
         break;
     }
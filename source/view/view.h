@@ -9,7 +9,12 @@
 namespace s21 {
 class View {
  public:
-  enum class AlgoritmSolveTSM { kAntColony, kGenetic, kSimulatedAnnealing };
+  enum class AlgoritmSolveTSM {
+    kAntColony,
+    kGenetic,
+    kSimulatedAnnealing,
+    kLinKernighan
+  };
   enum class MatrixFunctionsType { kShortestPaths, kLeastSpanningTree };
   enum class FirstSearchType { kBreadth, kDepth };
 
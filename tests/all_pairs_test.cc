@@ -0,0 +1,82 @@
+#include "common_tests.h"
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+#include "model/shortest_path/all_pairs_shortest_paths.h"
+
+namespace s21 {
+
+namespace {
+
+AllPairsParams Forced(AllPairsAlgorithm algorithm, size_t threads = 0) {
+  AllPairsParams params;
+  params.algorithm = algorithm;
+  params.thread_count = threads;
+  return params;
+}
+
+}  // namespace
+
+TEST(AllPairsShortestPaths, DijkstraMatchesFloydWarshall) {
+  for (double density : {0.005, 0.05, 0.6}) {
+    Graph graph = RandomGraph(150, density, false, 7);
+    CsrGraph csr(graph);
+    AllPairsShortestPaths::MatrixAdjacency expected =
+        AllPairsShortestPaths(Forced(AllPairsAlgorithm::kFloydWarshall))
+            .Solve(graph);
+    for (size_t threads : {1, 3}) {
+      AllPairsShortestPaths dijkstra(
+          Forced(AllPairsAlgorithm::kDijkstra, threads));
+      ASSERT_EQ(dijkstra.Solve(graph), expected) << density;
+      ASSERT_EQ(dijkstra.Solve(csr), expected) << density;
+    }
+    ASSERT_EQ(AllPairsShortestPaths(Forced(AllPairsAlgorithm::kFloydWarshall))
+                  .Solve(csr),
+              expected);
+  }
+}
+
+TEST(AllPairsShortestPaths, ChoosesByDensity) {
+  AllPairsShortestPaths solver;
+  ASSERT_EQ(solver.ChooseAlgorithm(RandomGraph(300, 0.002, false, 1)),
+            AllPairsAlgorithm::kDijkstra);
+  ASSERT_EQ(solver.ChooseAlgorithm(CsrGraph(RandomGraph(300, 0.002, false, 1))),
+            AllPairsAlgorithm::kDijkstra);
+  ASSERT_EQ(solver.ChooseAlgorithm(RandomGraph(300, 0.2, false, 1)),
+            AllPairsAlgorithm::kFloydWarshall);
+
+  AllPairsParams params;
+  params.dijkstra_max_density = 0.5;
+  ASSERT_EQ(AllPairsShortestPaths(params).ChooseAlgorithm(
+                RandomGraph(300, 0.2, false, 1)),
+            AllPairsAlgorithm::kDijkstra);
+  ASSERT_EQ(AllPairsShortestPaths(Forced(AllPairsAlgorithm::kFloydWarshall))
+                .ChooseAlgorithm(RandomGraph(300, 0.002, false, 1)),
+            AllPairsAlgorithm::kFloydWarshall);
+}
+
+TEST(AllPairsShortestPaths, DiagonalWeightsKeepFloydWarshall) {
+  Graph graph(Graph::MatrixAdjacency{{5, 1, 0}, {0, 0, 0}, {0, 0, 0}});
+  AllPairsParams params;
+  params.dijkstra_max_density = 1.0;
+  AllPairsShortestPaths solver(params);
+  ASSERT_EQ(solver.ChooseAlgorithm(graph), AllPairsAlgorithm::kFloydWarshall);
+  ASSERT_EQ(solver.Solve(graph)[0][0], 5);
+}
+
+TEST(AllPairsShortestPaths, ExampleGraphBothAlgorithms) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "example3.txt");
+  GraphAlgorithms algorithms;
+  GraphAlgorithms::MatrixAdjacency expected =
+      algorithms.GetShortestPathsBetweenAllVertices(graph);
+  ASSERT_EQ(expected[0][7], 11);
+  ASSERT_EQ(algorithms.GetShortestPathsBetweenAllVertices(
+                graph, Forced(AllPairsAlgorithm::kDijkstra)),
+            expected);
+  ASSERT_EQ(algorithms.GetShortestPathsBetweenAllVertices(
+                CsrGraph(graph), Forced(AllPairsAlgorithm::kDijkstra)),
+            expected);
+}
+
+}  // namespace s21
@@ -0,0 +1,68 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "common_tests.h"
+#include "libs/s21_random_stream.h"
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/ant_colony_algorithm/ant.h"
+#include "model/traveling_salesman/ant_colony_algorithm/choice_info.h"
+#include "model/traveling_salesman/ant_colony_algorithm/pheromone.h"
+
+namespace {
+
+// Heap allocations made through the global operator new by any thread.
+std::atomic<size_t> allocation_count{0};
+
+}  // namespace
+
+// GCC sees the malloc behind operator new once these are inlined into a
+// new/delete pair and reports it as a mismatch with free.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(size_t size) {
+  ++allocation_count;
+  if (void *pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, size_t) noexcept {
+  ::operator delete(pointer);
+}
+
+namespace s21 {
+
+TEST(AntAllocation, ToursAfterWarmUpDoNotAllocate) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  CsrGraph adjacency(graph);
+  ChoiceInfo choice_info(adjacency, 1, 2, 4);
+  Pheromones pheromones(graph.GetSize(), 1, 0.1);
+  choice_info.Refresh(pheromones);
+  RandomStream gen(42);
+  Ant ant(graph, adjacency);
+  TsmResult tour;
+  tour.vertices.reserve(graph.GetSize() + 1);
+
+  ant.Reset(gen);
+  while (ant.Move(choice_info)) {
+  }
+  size_t before = allocation_count.load();
+  for (size_t i = 0; i < 100; ++i) {
+    ant.Reset(gen);
+    while (ant.Move(choice_info)) {
+    }
+    tour = ant.GetPath();
+  }
+  size_t allocations = allocation_count.load() - before;
+
+  ASSERT_EQ(allocations, 0);
+  ASSERT_EQ(tour.vertices.size(), graph.GetSize() + 1);
+}
+
+}  // namespace s21
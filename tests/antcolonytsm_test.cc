@@ -1,6 +1,13 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 #include "common_tests.h"
 #include "model/s21_graph.h"
 #include "model/s21_graph_algorithms.h"
+#include "model/traveling_salesman/ant_colony_algorithm/ant_colony_solver.h"
+#include "model/traveling_salesman/ant_colony_algorithm/choice_info.h"
+#include "model/traveling_salesman/ant_colony_algorithm/pheromone_update.h"
 
 namespace s21 {
 
@@ -65,4 +72,225 @@ TEST(AntColonyTest, MultipleRunsGraphNoCheckLeaks) {
   }
 }
 
+TEST(AntColonyTest, ParallelIterations) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+
+  for (size_t threads : {1, 4}) {
+    for (size_t ants_per_iteration : {1, 7, 32}) {
+      AntColonyParams params;
+      params.ants_per_iteration = ants_per_iteration;
+      params.thread_count = threads;
+      params.seed = ants_per_iteration;
+      TsmResult result = AntColony(graph, 1, 300, params).Solve();
+
+      ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+      ASSERT_EQ(result.vertices.front(), result.vertices.back());
+      std::vector<size_t> visited(result.vertices.begin(),
+                                  result.vertices.end() - 1);
+      std::sort(visited.begin(), visited.end());
+      for (size_t i = 0; i < visited.size(); ++i) ASSERT_EQ(visited[i], i);
+      ASSERT_LT(result.distance, 270);
+    }
+  }
+}
+
+TEST(AntColonyTest, SeedIgnoresThreadCount) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  AntColonyParams params;
+  params.ants_per_iteration = 7;
+  params.seed = 5;
+  params.thread_count = 1;
+  TsmResult single = AntColony(graph, 2, 100, params).Solve();
+  params.thread_count = 3;
+  TsmResult several = AntColony(graph, 2, 100, params).Solve();
+  ASSERT_EQ(single.vertices, several.vertices);
+  ASSERT_EQ(single.distance, several.distance);
+}
+
+TEST(AntColonyTest, SeededEntryPointRepeats) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  GraphAlgorithms algorithms;
+  AntColonyParams params;
+  params.seed = 3;
+  TsmResult first = algorithms.SolveTravelingSalesmanProblem(
+      graph, PheromoneUpdateType::kMaxMinAntSystem, params);
+  TsmResult second = algorithms.SolveTravelingSalesmanProblem(
+      graph, PheromoneUpdateType::kMaxMinAntSystem, params);
+  ASSERT_EQ(first.vertices, second.vertices);
+  ASSERT_EQ(first.distance, second.distance);
+}
+
+TEST(AntColonyTest, ChoiceInfoCandidates) {
+  CsrGraph graph(4, {{0, 1, 5}, {0, 2, 1}, {0, 3, 3}, {1, 0, 5}, {2, 3, 2}});
+  ChoiceInfo choice_info(graph, 1, 2, 2);
+  Pheromones pheromones(4, 3, 0.1);
+  choice_info.Refresh(pheromones);
+
+  Span<const size_t> candidates = choice_info.GetCandidates(0);
+  ASSERT_EQ(candidates.Size(), 2);
+  ASSERT_EQ(candidates[0], 2);
+  ASSERT_EQ(candidates[1], 3);
+  ASSERT_EQ(choice_info.GetCandidates(1).Size(), 1);
+  ASSERT_TRUE(choice_info.GetCandidates(3).Empty());
+  ASSERT_DOUBLE_EQ(choice_info.GetValue(0, 3), 3.0 / 9);
+  ASSERT_DOUBLE_EQ(choice_info.GetValue(2, 3), 3.0 / 4);
+  ASSERT_EQ(choice_info.GetValue(3, 0), 0);
+}
+
+TEST(AntColonyTest, LazyEvaporationMatchesEager) {
+  const size_t size = 6;
+  const double rate = 0.9;
+  Pheromones pheromones(size, 2, rate);
+  std::vector<double> expected(size * size, 2);
+  for (size_t i = 0; i < size; ++i) expected[i * size + i] = 0;
+
+  // Enough evaporations at this rate to force a few rescales.
+  std::mt19937 gen(1);
+  for (size_t step = 0; step < 350; ++step) {
+    TsmResult tour{{0, 1, 2, 3, 4, 5, 0}, 10.0 + step % 7};
+    std::shuffle(tour.vertices.begin() + 1, tour.vertices.end() - 1, gen);
+    pheromones.Deposit(tour, 15);
+    for (size_t i = 0; i + 1 < tour.vertices.size(); ++i) {
+      size_t from = tour.vertices[i], to = tour.vertices[i + 1];
+      expected[from * size + to] += 15 / tour.distance;
+      expected[to * size + from] += 15 / tour.distance;
+    }
+    ASSERT_EQ(pheromones.GetDepositedEntries().Size(), 2 * size);
+    pheromones.Evaporate();
+    for (double &value : expected) value *= 1 - rate;
+  }
+
+  ASSERT_GT(pheromones.GetGeneration(), 0);
+  ASSERT_TRUE(pheromones.GetDepositedEntries().Empty());
+  for (size_t from = 0; from < size; ++from) {
+    for (size_t to = 0; to < size; ++to) {
+      double value = expected[from * size + to];
+      ASSERT_NEAR(pheromones.GetValue(from, to), value, value * 1e-9);
+    }
+  }
+}
+
+TEST(AntColonyTest, ChoiceInfoRefreshesDeposits) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  CsrGraph adjacency(graph);
+  Pheromones pheromones(graph.GetSize(), 1, 0.5);
+  ChoiceInfo incremental(adjacency, 2, 1, 5);
+  incremental.Refresh(pheromones);
+
+  std::vector<size_t> cities(graph.GetSize());
+  std::iota(cities.begin(), cities.end(), 0);
+  std::mt19937 gen(3);
+  for (size_t step = 0; step < 400; ++step) {
+    std::shuffle(cities.begin(), cities.end(), gen);
+    TsmResult tour{cities, 100};
+    tour.vertices.push_back(cities.front());
+    pheromones.Deposit(tour, 15);
+    incremental.RefreshDeposits(pheromones);
+    pheromones.Evaporate();
+  }
+
+  ChoiceInfo full(adjacency, 2, 1, 5);
+  full.Refresh(pheromones);
+  for (size_t from = 0; from < graph.GetSize(); ++from) {
+    for (size_t to = 0; to < graph.GetSize(); ++to) {
+      ASSERT_DOUBLE_EQ(incremental.GetValue(from, to),
+                       full.GetValue(from, to));
+    }
+  }
+}
+
+TEST(AntColonyTest, ChoiceInfoRefreshesBoundedTrails) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  CsrGraph adjacency(graph);
+  Pheromones pheromones(graph.GetSize(), 1, 0.2);
+  pheromones.SetBounds(0.05, 2);
+  ChoiceInfo incremental(adjacency, 1, 1, 5);
+  incremental.Refresh(pheromones);
+
+  // The same tour every round, so most arcs sit at the lower bound.
+  std::vector<size_t> cities(graph.GetSize());
+  std::iota(cities.begin(), cities.end(), 0);
+  TsmResult tour{cities, 100};
+  tour.vertices.push_back(0);
+  for (size_t step = 0; step < 30; ++step) {
+    pheromones.Deposit(tour, 15);
+    incremental.RefreshDeposits(pheromones);
+    pheromones.Evaporate();
+    incremental.RefreshDeposits(pheromones);
+
+    ChoiceInfo full(adjacency, 1, 1, 5);
+    full.Refresh(pheromones);
+    for (size_t from = 0; from < graph.GetSize(); ++from) {
+      for (size_t to = 0; to < graph.GetSize(); ++to) {
+        ASSERT_DOUBLE_EQ(incremental.GetValue(from, to),
+                         full.GetValue(from, to))
+            << step;
+      }
+    }
+  }
+}
+
+TEST(AntColonyTest, UpdateStrategies) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  MaxMinAntSystemUpdate max_min_ant_system;
+  AntColonySystemUpdate ant_colony_system;
+  AntColonyParams params;
+  params.seed = 7;
+
+  for (PheromoneUpdateStrategy *update :
+       {static_cast<PheromoneUpdateStrategy *>(&max_min_ant_system),
+        static_cast<PheromoneUpdateStrategy *>(&ant_colony_system)}) {
+    // One colony of 1000 ants, as GraphAlgorithms runs them.
+    TsmResult result = AntColony(graph, *update, 1, 1000, params).Solve();
+    ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+    ASSERT_LT(result.distance, 270);
+    ASSERT_GT(result.distance, 250);
+  }
+}
+
+TEST(AntColonyTest, MaxMinTrailsStayInBounds) {
+  const size_t size = 5;
+  Pheromones pheromones(size, 1, 0.2);
+  MaxMinAntSystemUpdate update(0.2, 0);
+  update.Initialize(pheromones, size);
+  std::vector<TsmResult> tours = {{{0, 1, 2, 3, 4, 0}, 50},
+                                  {{0, 2, 1, 4, 3, 0}, 40}};
+  for (size_t i = 0; i < 200; ++i) {
+    pheromones.Evaporate();
+    update.Execute(pheromones, Span<const TsmResult>(tours.data(), 2),
+                   tours[1]);
+  }
+
+  const double max_value = 1 / (0.2 * 40);
+  ASSERT_DOUBLE_EQ(pheromones.GetValue(0, 2), max_value);
+  ASSERT_DOUBLE_EQ(pheromones.GetValue(0, 1), max_value / (2 * size));
+  ASSERT_DOUBLE_EQ(pheromones.GetValue(3, 1), max_value / (2 * size));
+}
+
+TEST(AntColonyTest, ColonySystemReinforcesBestTour) {
+  const size_t size = 4;
+  Pheromones pheromones(size, 1, 0);
+  AntColonySystemUpdate update(0.9, 0.1, 0.1);
+  update.Initialize(pheromones, size);
+  ASSERT_DOUBLE_EQ(update.GetExploitation(), 0.9);
+  ASSERT_EQ(update.GetEvaporationRate(32), 0);
+
+  std::vector<TsmResult> tours = {{{0, 1, 2, 3, 0}, 20}};
+  update.Execute(pheromones, Span<const TsmResult>(tours.data(), 1),
+                 tours[0]);
+  const double initial_level = 1.0 / (size * 20);
+  // The local blend towards tau0 leaves tau0 in place; the global one then
+  // moves a tenth of the way to 1 / L.
+  double expected = 0.9 * initial_level + 0.1 / 20;
+  ASSERT_DOUBLE_EQ(pheromones.GetValue(0, 1), expected);
+  ASSERT_DOUBLE_EQ(pheromones.GetValue(1, 0), expected);
+  ASSERT_DOUBLE_EQ(pheromones.GetValue(0, 2), initial_level);
+}
+
 } // namespace s21
@@ -0,0 +1,126 @@
+#include <chrono>
+
+#include "common_tests.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+#include "model/traveling_salesman/common/solve_control.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr TsmAlgorithm kAlgorithms[] = {
+    TsmAlgorithm::kAntColony, TsmAlgorithm::kGeneticAlgorithm,
+    TsmAlgorithm::kSimulatedAnnealing, TsmAlgorithm::kLinKernighan};
+
+}  // namespace
+
+TEST(AnytimeTsp, Deadline) {
+  Graph graph = RandomGraph(120, 1, false, 1);
+  GraphAlgorithms algorithms;
+  for (TsmAlgorithm algorithm : kAlgorithms) {
+    std::vector<double> reported;
+    SolveControl control =
+        SolveControl::WithTimeout(std::chrono::milliseconds(100));
+    control.on_improvement = [&](const TsmResult &tour) {
+      EXPECT_DOUBLE_EQ(TourLength(graph, tour), tour.distance);
+      reported.push_back(tour.distance);
+    };
+    auto start = std::chrono::steady_clock::now();
+    TsmResult result =
+        algorithms.SolveTravelingSalesmanProblem(graph, algorithm, control);
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    // The solvers look at the deadline between steps, so they overrun it
+    // by at most one of them.
+    ASSERT_LT(elapsed.count(), 2.0);
+    ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+    ASSERT_DOUBLE_EQ(TourLength(graph, result), result.distance);
+    ASSERT_FALSE(reported.empty());
+    for (size_t i = 1; i < reported.size(); ++i) {
+      ASSERT_LT(reported[i], reported[i - 1]);
+    }
+    ASSERT_DOUBLE_EQ(reported.back(), result.distance);
+  }
+}
+
+TEST(AnytimeTsp, Cancellation) {
+  Graph graph = RandomGraph(60, 1, false, 2);
+  GraphAlgorithms algorithms;
+  for (TsmAlgorithm algorithm : kAlgorithms) {
+    CancellationToken token;
+    SolveControl control;
+    control.cancellation = &token;
+    size_t reported = 0;
+    control.on_improvement = [&](const TsmResult &) {
+      ++reported;
+      token.Cancel();
+    };
+    // Without the token this would never return.
+    TsmResult result =
+        algorithms.SolveTravelingSalesmanProblem(graph, algorithm, control);
+
+    ASSERT_TRUE(token.IsCancelled());
+    ASSERT_GE(reported, 1);
+    ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+    ASSERT_DOUBLE_EQ(TourLength(graph, result), result.distance);
+  }
+}
+
+TEST(AnytimeTsp, TinyGraphs) {
+  GraphAlgorithms algorithms;
+  for (const char *file : {"graph_1x1.txt", "graph_2x2.txt"}) {
+    Graph graph;
+    graph.LoadGraphFromFile(kAssetsDir + file);
+    for (TsmAlgorithm algorithm : kAlgorithms) {
+      auto start = std::chrono::steady_clock::now();
+      TsmResult result = algorithms.SolveTravelingSalesmanProblem(
+          graph, algorithm,
+          SolveControl::WithTimeout(std::chrono::milliseconds(100)));
+      std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+
+      ASSERT_LT(elapsed.count(), 2.0) << file;
+      ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1) << file;
+      ASSERT_DOUBLE_EQ(TourLength(graph, result), result.distance) << file;
+    }
+  }
+}
+
+TEST(AnytimeTsp, FixedBudget) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  GraphAlgorithms algorithms;
+  SolveControl control;
+  ASSERT_FALSE(control.IsBounded());
+  ASSERT_FALSE(control.ShouldStop());
+  TsmResult result = algorithms.SolveTravelingSalesmanProblem(
+      graph, TsmAlgorithm::kLinKernighan, control);
+  ASSERT_EQ(result.distance, 253);
+
+  TsmResult immediate = algorithms.SolveTravelingSalesmanProblem(
+      graph, TsmAlgorithm::kSimulatedAnnealing,
+      SolveControl::WithTimeout(std::chrono::milliseconds(0)));
+  ASSERT_EQ(immediate.vertices.size(), graph.GetSize() + 1);
+}
+
+TEST(AnytimeTsp, SeededParams) {
+  Graph graph = RandomGraph(30, 1, false, 4);
+  GraphAlgorithms algorithms;
+  TsmParams params;
+  params.ant_colony.seed = 1;
+  params.genetic.seed = 2;
+  params.annealing.seed = 3;
+  params.lin_kernighan.seed = 4;
+  for (TsmAlgorithm algorithm : kAlgorithms) {
+    TsmResult first = algorithms.SolveTravelingSalesmanProblem(
+        graph, algorithm, SolveControl{}, params);
+    TsmResult second = algorithms.SolveTravelingSalesmanProblem(
+        graph, algorithm, SolveControl{}, params);
+    ASSERT_EQ(first.vertices, second.vertices);
+    ASSERT_DOUBLE_EQ(TourLength(graph, first), first.distance);
+  }
+}
+
+}  // namespace s21
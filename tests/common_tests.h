@@ -3,10 +3,73 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
 #include <string>
+#include <vector>
+
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/common/path_structure.h"
 
 namespace s21 {
 const std::string kAssetsDir = std::string(SIMPLE_NAVIGATOR_ASSETS_DIR) + "/";
+
+// Weights from 1 to 50. Every arc, or every pair of opposite arcs when
+// `symmetric`, is there with probability `density`; complete graphs draw
+// no coin for it.
+inline Graph RandomGraph(size_t size, double density, bool symmetric,
+                         unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<size_t> weight(1, 50);
+  Graph graph(size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = symmetric ? i + 1 : 0; j < size; ++j) {
+      if (i == j || (density < 1 && coin(gen) >= density)) continue;
+      size_t value = weight(gen);
+      graph.SetValue(i, j, value);
+      if (symmetric) graph.SetValue(j, i, value);
+    }
+  }
+  return graph;
+}
+
+// Complete graph of random points in a 1000 x 1000 square, each arc one
+// longer than the distance so none of them is missing.
+inline Graph EuclideanGraph(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> coordinate(0, 1000);
+  std::vector<double> x(size);
+  std::vector<double> y(size);
+  for (size_t i = 0; i < size; ++i) {
+    x[i] = coordinate(gen);
+    y[i] = coordinate(gen);
+  }
+  Graph graph(size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < size; ++j) {
+      if (i == j) continue;
+      graph.SetValue(i, j, 1 + std::hypot(x[i] - x[j], y[i] - y[j]));
+    }
+  }
+  return graph;
 }
 
-#endif  // SIMPLE_NAVIGATOR_TESTS_COMMON_TESTS_H_
\ No newline at end of file
+// Checks that `tour` is a closed permutation and returns its length.
+inline double TourLength(const Graph &graph, const TsmResult &tour) {
+  EXPECT_EQ(tour.vertices.size(), graph.GetSize() + 1);
+  EXPECT_EQ(tour.vertices.front(), tour.vertices.back());
+  std::vector<size_t> sorted(tour.vertices.begin(), tour.vertices.end() - 1);
+  std::sort(sorted.begin(), sorted.end());
+  for (size_t i = 0; i < sorted.size(); ++i) EXPECT_EQ(sorted[i], i);
+  double distance = 0;
+  for (size_t i = 0; i + 1 < tour.vertices.size(); ++i) {
+    distance += graph.GetValue(tour.vertices[i], tour.vertices[i + 1]);
+  }
+  return distance;
+}
+
+}  // namespace s21
+
+#endif  // SIMPLE_NAVIGATOR_TESTS_COMMON_TESTS_H_
@@ -0,0 +1,89 @@
+#include "common_tests.h"
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+
+namespace s21 {
+
+TEST(CsrGraph, ConvertFromGraph) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "example3.txt");
+  CsrGraph csr(graph);
+
+  ASSERT_EQ(csr.GetSize(), graph.GetSize());
+  size_t edges = 0;
+  for (size_t from = 0; from < graph.GetSize(); ++from) {
+    std::vector<size_t> weights = graph.GetNeighbors(from);
+    Span<const size_t> csr_weights = csr.GetWeights(from);
+    ASSERT_EQ(csr.GetDegree(from), weights.size());
+    for (size_t i = 0; i < weights.size(); ++i) {
+      ASSERT_EQ(csr_weights[i], weights[i]);
+    }
+    for (Arc arc : csr.GetArcs(from)) {
+      ASSERT_EQ(arc.weight, graph.GetValue(from, arc.to));
+    }
+    edges += weights.size();
+  }
+  ASSERT_EQ(csr.GetEdgeCount(), edges);
+  ASSERT_EQ(csr.ToGraph().GetData(), graph.GetData());
+}
+
+TEST(CsrGraph, BuildFromEdges) {
+  CsrGraph csr(4, {{2, 1, 7}, {0, 3, 1}, {0, 1, 5}, {3, 2, 2}});
+
+  ASSERT_EQ(csr.GetSize(), 4);
+  ASSERT_EQ(csr.GetEdgeCount(), 4);
+  ASSERT_EQ(csr.GetDegree(0), 2);
+  ASSERT_EQ(csr.GetDegree(1), 0);
+  ASSERT_EQ(csr.GetTargets(0)[0], 1);
+  ASSERT_EQ(csr.GetTargets(0)[1], 3);
+  ASSERT_EQ(csr.GetWeights(0)[0], 5);
+  ASSERT_EQ(csr.GetWeights(0)[1], 1);
+  ASSERT_EQ(csr.ToGraph().GetValue(2, 1), 7);
+}
+
+TEST(CsrGraph, InvalidEdgesThrow) {
+  ASSERT_THROW(CsrGraph(2, {{0, 2, 1}}), std::out_of_range);
+  ASSERT_THROW(CsrGraph(2, {{0, 1, 0}}), std::invalid_argument);
+  CsrGraph csr(2, {{0, 1, 1}});
+  ASSERT_THROW(csr.GetArcs(2), std::out_of_range);
+}
+
+TEST(CsrGraph, EmptyGraph) {
+  CsrGraph csr;
+  ASSERT_TRUE(csr.GraphIsEmpty());
+  ASSERT_EQ(csr.GetEdgeCount(), 0);
+}
+
+TEST(CsrGraph, TraversalsMatchDenseGraph) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "example2.txt");
+  CsrGraph csr(graph);
+  GraphAlgorithms algorithms;
+
+  for (size_t vertex = 1; vertex <= graph.GetSize(); ++vertex) {
+    ASSERT_EQ(algorithms.DepthFirstSearch(csr, vertex),
+              algorithms.DepthFirstSearch(graph, vertex));
+    ASSERT_EQ(algorithms.BreadthFirstSearch(csr, vertex),
+              algorithms.BreadthFirstSearch(graph, vertex));
+  }
+  ASSERT_THROW(algorithms.DepthFirstSearch(csr, 0), std::invalid_argument);
+  ASSERT_THROW(algorithms.BreadthFirstSearch(csr, 14), std::out_of_range);
+}
+
+TEST(CsrGraph, ShortestPathMatchesDenseGraph) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "example3.txt");
+  CsrGraph csr(graph);
+  GraphAlgorithms algorithms;
+
+  for (size_t from = 1; from <= graph.GetSize(); ++from) {
+    for (size_t to = 1; to <= graph.GetSize(); ++to) {
+      ASSERT_EQ(algorithms.GetShortestPathBetweenVertices(csr, from, to),
+                algorithms.GetShortestPathBetweenVertices(graph, from, to));
+    }
+  }
+  ASSERT_EQ(algorithms.GetShortestPathBetweenVertices(csr, 1, 8), 11);
+}
+
+}  // namespace s21
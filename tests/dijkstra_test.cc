@@ -0,0 +1,123 @@
+#include "common_tests.h"
+#include "libs/s21_indexed_heap.h"
+#include "libs/s21_radix_heap.h"
+#include "model/s21_csr_graph.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+#include "model/shortest_path/dijkstra.h"
+
+namespace s21 {
+
+TEST(IndexedHeap, PopsInKeyOrder) {
+  IndexedHeap<size_t, 3> heap(6);
+  std::vector<size_t> keys{40, 10, 50, 30, 20, 60};
+  for (size_t i = 0; i < keys.size(); ++i) heap.Push(i, keys[i]);
+
+  std::vector<size_t> order;
+  while (!heap.Empty()) {
+    order.push_back(heap.Top());
+    heap.Pop();
+  }
+  ASSERT_EQ(order, (std::vector<size_t>{1, 4, 3, 0, 2, 5}));
+}
+
+TEST(IndexedHeap, DecreaseKeyAndReset) {
+  IndexedHeap<size_t> heap(4);
+  heap.Push(0, 10);
+  heap.Push(1, 20);
+  heap.Push(1, 5);
+  heap.Push(0, 30);
+  ASSERT_EQ(heap.Size(), 2);
+  ASSERT_EQ(heap.Top(), 1);
+  ASSERT_EQ(heap.TopKey(), 5);
+  ASSERT_EQ(heap.GetKey(0), 10);
+  ASSERT_THROW(heap.Push(4, 1), std::out_of_range);
+
+  heap.Reset(4);
+  ASSERT_TRUE(heap.Empty());
+  ASSERT_FALSE(heap.Contains(0));
+}
+
+TEST(RadixHeap, PopsMonotoneKeys) {
+  RadixHeap<size_t> heap;
+  heap.Push(7, 0);
+  heap.Push(3, 1);
+  heap.Push(1000000, 2);
+  heap.Push(3, 3);
+  ASSERT_EQ(heap.Top().first, 3);
+  heap.Pop();
+  ASSERT_EQ(heap.Top().first, 3);
+  heap.Pop();
+  ASSERT_THROW(heap.Push(2, 4), std::invalid_argument);
+  heap.Push(5, 5);
+  ASSERT_EQ(heap.Top().second, 5);
+  heap.Pop();
+  ASSERT_EQ(heap.Top().second, 0);
+  heap.Pop();
+  ASSERT_EQ(heap.Top().first, 1000000);
+  heap.Pop();
+  ASSERT_TRUE(heap.Empty());
+}
+
+class TestDijkstra : public ::testing::TestWithParam<PriorityQueueType> {
+ protected:
+  void SetUp() { graph.LoadGraphFromFile(kAssetsDir + "example3.txt"); }
+
+  Graph graph;
+  GraphAlgorithms algorithms;
+};
+
+TEST_P(TestDijkstra, MatchesAllPairs) {
+  GraphAlgorithms::MatrixAdjacency expected =
+      algorithms.GetShortestPathsBetweenAllVertices(graph);
+  CsrGraph csr(graph);
+  Dijkstra dijkstra(GetParam());
+  for (size_t from = 0; from < graph.GetSize(); ++from) {
+    dijkstra.Run(csr, from);
+    ASSERT_EQ(dijkstra.GetDistances(), expected[from]);
+    for (size_t to = 0; to < graph.GetSize(); ++to) {
+      ASSERT_EQ(algorithms.GetShortestPathBetweenVertices(graph, from + 1,
+                                                          to + 1, GetParam()),
+                expected[from][to]);
+    }
+  }
+}
+
+TEST_P(TestDijkstra, StopsAtTarget) {
+  Dijkstra dijkstra(GetParam());
+  dijkstra.Run(graph, 0, 1);
+  ASSERT_EQ(dijkstra.GetDistance(1), 2);
+  ASSERT_EQ(dijkstra.GetDistance(0), 0);
+  ASSERT_THROW(dijkstra.Run(graph, 0, 9), std::out_of_range);
+  ASSERT_THROW(dijkstra.GetDistance(9), std::out_of_range);
+}
+
+TEST_P(TestDijkstra, RouteFollowsPredecessors) {
+  CsrGraph csr(4, {{0, 1, 1}, {1, 2, 1}, {0, 2, 5}, {2, 3, 1}});
+  Dijkstra dijkstra(GetParam());
+  dijkstra.Run(csr, 0);
+  ASSERT_EQ(dijkstra.GetPredecessor(0), Dijkstra::kNoVertex);
+  ASSERT_EQ(dijkstra.GetPredecessor(2), 1);
+
+  RouteResult route = dijkstra.GetRoute(3);
+  ASSERT_EQ(route.distance, 3);
+  ASSERT_EQ(route.vertices, (std::vector<size_t>{0, 1, 2, 3}));
+}
+
+TEST_P(TestDijkstra, UnreachableVertex) {
+  CsrGraph csr(3, {{0, 1, 4}, {1, 0, 4}});
+  RouteResult route =
+      algorithms.GetShortestRouteBetweenVertices(csr, 1, 3, GetParam());
+  ASSERT_TRUE(route.vertices.empty());
+  ASSERT_EQ(route.distance, Dijkstra::kUnreachable);
+  ASSERT_EQ(algorithms.GetShortestPathBetweenVertices(csr, 1, 3, GetParam()),
+            Dijkstra::kUnreachable);
+  ASSERT_EQ(algorithms.GetShortestPathBetweenVertices(csr, 2, 1, GetParam()),
+            4);
+}
+
+INSTANTIATE_TEST_SUITE_P(QueueTypes, TestDijkstra,
+                         ::testing::Values(PriorityQueueType::kDaryHeap,
+                                           PriorityQueueType::kRadixHeap));
+
+}  // namespace s21
@@ -0,0 +1,140 @@
+#include <random>
+
+#include "common_tests.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+#include "model/shortest_path/floyd_warshall.h"
+#include "model/shortest_path/min_plus_kernel.h"
+
+namespace s21 {
+
+namespace {
+
+const size_t kUnreachable = std::numeric_limits<size_t>::max();
+
+// Row-major distance matrix of a random directed graph, `infinity` where
+// there is no arc.
+template <class Distance>
+std::vector<Distance> RandomDistances(size_t size, double density,
+                                      unsigned seed, Distance infinity) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<Distance> weight(1, 100);
+  std::vector<Distance> distances(size * size, infinity);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < size; ++j) {
+      if (i == j) {
+        distances[i * size + j] = 0;
+      } else if (coin(gen) < density) {
+        distances[i * size + j] = weight(gen);
+      }
+    }
+  }
+  return distances;
+}
+
+// The unblocked triple loop GetShortestPathsBetweenAllVertices used before.
+template <class Distance>
+void ReferenceFloydWarshall(std::vector<Distance> &d, size_t n,
+                            Distance infinity) {
+  for (size_t k = 0; k < n; ++k) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        Distance weight = d[i * n + k] + d[k * n + j];
+        if (d[i * n + k] != infinity && d[k * n + j] != infinity &&
+            d[i * n + j] > weight)
+          d[i * n + j] = weight;
+      }
+    }
+  }
+}
+
+template <class Distance>
+void CheckAgainstReference() {
+  const Distance kInfinity = MinPlusKernel<Distance>::kInfinity;
+  for (size_t size : {1, 5, 63, 64, 65, 130}) {
+    for (double density : {0.05, 0.5}) {
+      std::vector<Distance> expected =
+          RandomDistances(size, density, size, kInfinity);
+      std::vector<Distance> input = expected;
+      ReferenceFloydWarshall(expected, size, kInfinity);
+      for (size_t block : {1, 7, 64}) {
+        for (size_t threads : {1, 3}) {
+          for (SimdLevel level :
+               {SimdLevel::kScalar, SimdLevel::kSse4, SimdLevel::kAvx2}) {
+            std::vector<Distance> result = input;
+            FloydWarshall(threads, block, level).Solve(result, size);
+            ASSERT_EQ(result, expected)
+                << "size " << size << " block " << block << " threads "
+                << threads << " level " << static_cast<int>(level);
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(FloydWarshall, MatchesReference32) { CheckAgainstReference<uint32_t>(); }
+
+TEST(FloydWarshall, MatchesReference64) { CheckAgainstReference<uint64_t>(); }
+
+TEST(FloydWarshall, InvalidArguments) {
+  ASSERT_THROW(FloydWarshall(1, 0), std::invalid_argument);
+  std::vector<uint64_t> distances(5);
+  ASSERT_THROW(FloydWarshall().Solve(distances, 2), std::length_error);
+  std::vector<uint32_t> empty;
+  ASSERT_NO_THROW(FloydWarshall().Solve(empty, 0));
+}
+
+TEST(MinPlusKernel, AllLevelsAgree) {
+  const uint64_t kInfinity = MinPlusKernel<uint64_t>::kInfinity;
+  std::vector<uint64_t> pivot_row{0, 3, kInfinity, 7, 1, 9, kInfinity};
+  std::vector<uint64_t> row{5, kInfinity, 2, 20, kInfinity, 1, kInfinity};
+  std::vector<uint64_t> expected{5, 8, 2, 12, 6, 1, kInfinity};
+  for (SimdLevel level : {SimdLevel::kAuto, SimdLevel::kScalar,
+                          SimdLevel::kSse4, SimdLevel::kAvx2}) {
+    MinPlusKernel<uint64_t> kernel(level);
+    ASSERT_LE(static_cast<int>(kernel.GetLevel()),
+              static_cast<int>(DetectSimdLevel()));
+    std::vector<uint64_t> result = row;
+    kernel(result.data(), pivot_row.data(), 5, result.size());
+    ASSERT_EQ(result, expected);
+
+    result = row;
+    kernel(result.data(), pivot_row.data(), kInfinity, result.size());
+    ASSERT_EQ(result, row);
+  }
+}
+
+TEST(FloydWarshall, DisconnectedGraph) {
+  Graph graph(Graph::MatrixAdjacency{{0, 3, 0}, {0, 0, 0}, {0, 0, 0}});
+  GraphAlgorithms algorithms;
+  GraphAlgorithms::MatrixAdjacency expected{{0, 3, kUnreachable},
+                                            {kUnreachable, 0, kUnreachable},
+                                            {kUnreachable, kUnreachable, 0}};
+  for (DistanceWidth width :
+       {DistanceWidth::kAuto, DistanceWidth::k32, DistanceWidth::k64}) {
+    AllPairsParams params;
+    params.distance_width = width;
+    ASSERT_EQ(algorithms.GetShortestPathsBetweenAllVertices(graph, params),
+              expected);
+  }
+}
+
+TEST(FloydWarshall, WeightsTooLargeFor32Bits) {
+  const size_t kWeight = size_t{1} << 31;
+  Graph graph(Graph::MatrixAdjacency{{0, kWeight}, {kWeight, 0}});
+  GraphAlgorithms algorithms;
+  AllPairsParams params;
+  params.distance_width = DistanceWidth::k32;
+  ASSERT_THROW(algorithms.GetShortestPathsBetweenAllVertices(graph, params),
+               std::overflow_error);
+
+  GraphAlgorithms::MatrixAdjacency result =
+      algorithms.GetShortestPathsBetweenAllVertices(graph);
+  ASSERT_EQ(result[0][1], kWeight);
+}
+
+}  // namespace s21
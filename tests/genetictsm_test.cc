@@ -1,9 +1,35 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+
 #include "common_tests.h"
 #include "model/s21_graph.h"
 #include "model/s21_graph_algorithms.h"
+#include "model/traveling_salesman/genetic_algorithm/crossover.h"
+#include "model/traveling_salesman/genetic_algorithm/edge_assembly_crossover.h"
+#include "model/traveling_salesman/genetic_algorithm/mutation.h"
+#include "model/traveling_salesman/genetic_algorithm/population.h"
+#include "model/traveling_salesman/genetic_algorithm/selection.h"
 
 namespace s21 {
 
+namespace {
+
+std::set<std::pair<size_t, size_t>> Edges(const Population &population,
+                                          size_t index) {
+  Span<const size_t> tour = population.GetGenes(index);
+  std::set<std::pair<size_t, size_t>> edges;
+  for (size_t i = 0; i + 1 < tour.Size(); ++i) {
+    edges.emplace(std::min(tour[i], tour[i + 1]),
+                  std::max(tour[i], tour[i + 1]));
+  }
+  return edges;
+}
+
+}  // namespace
+
 TEST(GeneticTest, ThrowEmptyGraph) {
   Graph graph;
   ASSERT_THROW(graph.LoadGraphFromFile(kAssetsDir + "graph_0x0.txt"),
@@ -71,4 +97,177 @@ TEST(GeneticTest, MultipleRunsGraphNoCheckLeaks) {
   }
 }
 
-} // namespace s21
+TEST(GeneticTest, ParallelFitness) {
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<size_t> weight(1, 100);
+  Graph graph(40);
+  for (size_t i = 0; i < graph.GetSize(); ++i) {
+    for (size_t j = 0; j < graph.GetSize(); ++j) {
+      if (i != j && j % 7 != 3) graph.SetValue(i, j, weight(gen));
+    }
+  }
+  std::vector<size_t> vertices(graph.GetSize());
+  for (size_t i = 0; i < vertices.size(); ++i) vertices[i] = i;
+  Population serial(vertices, 64);
+  Population parallel(serial);
+  ThreadPool pool(3);
+  serial.ComputeFitness(graph);
+  parallel.ComputeFitness(graph, pool);
+  for (size_t i = 0; i < serial.GetSize(); ++i) {
+    auto genes = serial.GetGenes(i);
+    auto same = parallel.GetGenes(i);
+    ASSERT_TRUE(std::equal(genes.begin(), genes.end(), same.begin()));
+    ASSERT_EQ(serial.GetDistance(i), parallel.GetDistance(i));
+  }
+
+  std::vector<Chromosome> best = serial.GetBestChromosomes(3);
+  ASSERT_EQ(best.size(), 3);
+  ASSERT_EQ(best[0].distance, serial.GetDistance(serial.GetBestIndex()));
+  ASSERT_LE(best[0].distance, best[1].distance);
+  ASSERT_LE(best[1].distance, best[2].distance);
+  parallel.ReplaceWorst(best);
+  ASSERT_EQ(parallel.GetBestChromosomes(3)[2].distance, best[2].distance);
+}
+
+TEST(GeneticTest, IslandModel) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  GraphAlgorithms algorithms;
+  GeneticParams params;
+  params.island_count = 4;
+  params.thread_count = 2;
+  params.migration_interval = 5;
+  for (size_t i = 0; i < 10; ++i) {
+    TsmResult result =
+        algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(graph,
+                                                                 params);
+    ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+    ASSERT_LT(result.distance, 270);
+    ASSERT_GT(result.distance, 250);
+  }
+}
+
+TEST(GeneticTest, Generation) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  std::vector<size_t> vertices(graph.GetSize());
+  for (size_t i = 0; i < vertices.size(); ++i) vertices[i] = i;
+  Population parents(vertices, 30);
+  Population children(parents.GetSize(), parents.GetGeneCount());
+  parents.ComputeFitness(graph);
+  Population before(parents);
+
+  TournamentSelection selection;
+  OrderedCrossover crossover;
+  ExchangeMutation mutation;
+  std::vector<size_t> selected;
+  for (size_t generation = 0; generation < 20; ++generation) {
+    selection.Execute(parents, selected);
+    ASSERT_EQ(selected.size(), parents.GetSize());
+    for (size_t index : selected) ASSERT_LT(index, parents.GetSize());
+
+    crossover.Execute(parents, selected, children, 1.0);
+    mutation.Execute(children, 0.5);
+    if (generation == 0) {
+      for (size_t i = 0; i < parents.GetSize(); ++i) {
+        auto genes = parents.GetGenes(i);
+        ASSERT_TRUE(std::equal(genes.begin(), genes.end(),
+                               before.GetGenes(i).begin()));
+      }
+    }
+    for (size_t i = 0; i < children.GetSize(); ++i) {
+      auto genes = children.GetGenes(i);
+      ASSERT_EQ(genes[0], genes[genes.Size() - 1]);
+      std::vector<size_t> sorted(genes.begin(), genes.end() - 1);
+      std::sort(sorted.begin(), sorted.end());
+      ASSERT_EQ(sorted, vertices);
+    }
+    children.ComputeFitness(graph);
+    std::swap(parents, children);
+  }
+}
+
+TEST(GeneticTest, Crossovers) {
+  Graph graph = EuclideanGraph(60, 7);
+  std::vector<size_t> vertices(graph.GetSize());
+  for (size_t i = 0; i < vertices.size(); ++i) vertices[i] = i;
+  Population parents(vertices, 2);
+  Population children(2, parents.GetGeneCount());
+
+  std::vector<std::unique_ptr<CrossoverStrategy>> crossovers;
+  crossovers.push_back(std::make_unique<OrderedCrossover>());
+  crossovers.push_back(std::make_unique<EdgeRecombinationCrossover>());
+  crossovers.push_back(std::make_unique<EdgeAssemblyCrossover>(graph));
+  for (size_t type = 0; type < crossovers.size(); ++type) {
+    for (size_t run = 0; run < 50; ++run) {
+      crossovers[type]->Execute(parents, {0, 1}, children, 1.0);
+      for (size_t i = 0; i < children.GetSize(); ++i) {
+        auto genes = children.GetGenes(i);
+        if (type != 0) {
+          ASSERT_EQ(genes[0], parents.GetGenes(i)[0]);
+        }
+        ASSERT_EQ(genes[0], genes[genes.Size() - 1]);
+        std::vector<size_t> sorted(genes.begin(), genes.end() - 1);
+        std::sort(sorted.begin(), sorted.end());
+        ASSERT_EQ(sorted, vertices);
+      }
+    }
+
+    // Both edge crossovers make nothing new out of two equal tours.
+    if (type == 0) continue;
+    crossovers[type]->Execute(parents, {0, 0}, children, 1.0);
+    ASSERT_EQ(Edges(children, 0), Edges(parents, 0));
+  }
+}
+
+TEST(GeneticTest, EdgeAssembly) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  GraphAlgorithms algorithms;
+  GeneticParams params;
+  params.crossover = CrossoverType::kEdgeAssembly;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(graph, params);
+  ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+  ASSERT_LT(result.distance, 260);
+
+  Graph random = EuclideanGraph(100, 11);
+  TsmResult assembled =
+      algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(random, params);
+  params.crossover = CrossoverType::kEdgeRecombination;
+  TsmResult recombined =
+      algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(random, params);
+  params.crossover = CrossoverType::kOrdered;
+  TsmResult ordered =
+      algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(random, params);
+  ASSERT_EQ(assembled.vertices.size(), random.GetSize() + 1);
+  ASSERT_EQ(recombined.vertices.size(), random.GetSize() + 1);
+  ASSERT_LT(assembled.distance, recombined.distance);
+  ASSERT_LT(recombined.distance, ordered.distance);
+}
+
+TEST(GeneticTest, SeedIgnoresThreadCount) {
+  Graph graph = EuclideanGraph(50, 3);
+  GraphAlgorithms algorithms;
+  for (CrossoverType crossover :
+       {CrossoverType::kOrdered, CrossoverType::kEdgeAssembly}) {
+    for (size_t islands : {1, 3}) {
+      GeneticParams params;
+      params.crossover = crossover;
+      params.island_count = islands;
+      params.seed = 9;
+      params.thread_count = 1;
+      TsmResult single =
+          algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(graph,
+                                                                   params);
+      params.thread_count = 3;
+      TsmResult several =
+          algorithms.SolveTravelingSalesmanProblemGeneticAlgorithm(graph,
+                                                                   params);
+      ASSERT_EQ(single.vertices, several.vertices);
+      ASSERT_EQ(single.distance, several.distance);
+    }
+  }
+}
+
+}  // namespace s21
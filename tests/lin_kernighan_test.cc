@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <random>
+
+#include "common_tests.h"
+#include "model/s21_graph.h"
+#include "model/s21_graph_algorithms.h"
+#include "model/traveling_salesman/common/local_search.h"
+#include "model/traveling_salesman/lin_kernighan/lin_kernighan.h"
+
+namespace s21 {
+
+TEST(LinKernighan, EmptyGraph) {
+  Graph graph;
+  GraphAlgorithms algorithms;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemLinKernighan(graph);
+
+  ASSERT_EQ(result.distance, std::numeric_limits<double>::infinity());
+}
+
+TEST(LinKernighan, SingleVertexGraph) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_1x1.txt");
+  GraphAlgorithms algorithms;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemLinKernighan(graph);
+
+  ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+  ASSERT_EQ(result.distance, 0);
+}
+
+TEST(LinKernighan, TwoVertexGraph) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_2x2.txt");
+  GraphAlgorithms algorithms;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemLinKernighan(graph);
+
+  ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+  ASSERT_EQ(result.distance, 4);
+}
+
+TEST(LinKernighan, NoSolutionGraph) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_no_solution.txt");
+  GraphAlgorithms algorithms;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemLinKernighan(graph);
+
+  ASSERT_EQ(result.distance, std::numeric_limits<double>::infinity());
+}
+
+TEST(LinKernighan, LargeGraph) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  GraphAlgorithms algorithms;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemLinKernighan(graph);
+
+  ASSERT_DOUBLE_EQ(TourLength(graph, result), result.distance);
+  ASSERT_EQ(result.distance, 253);
+}
+
+TEST(LinKernighan, BeatsTwoOptAndOrOpt) {
+  Graph graph = EuclideanGraph(400, 21);
+  GraphAlgorithms algorithms;
+  LinKernighanParams params;
+  params.kicks = 200;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemLinKernighan(graph, params);
+  ASSERT_DOUBLE_EQ(TourLength(graph, result), result.distance);
+
+  // The tour the kicks start from, without them and without Lin-Kernighan
+  // moves, has to be clearly longer.
+  params.kicks = 1;
+  params.max_depth = 1;
+  TsmResult shallow =
+      algorithms.SolveTravelingSalesmanProblemLinKernighan(graph, params);
+  ASSERT_LT(result.distance, shallow.distance * 0.98);
+}
+
+TEST(LinKernighan, LocalSearchMoves) {
+  Graph graph = EuclideanGraph(300, 4);
+  LocalSearchParams params;
+  params.lin_kernighan_depth = 10;
+  LocalSearch search(graph, params);
+
+  std::vector<size_t> order(graph.GetSize());
+  for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937(2));
+  order.push_back(order.front());
+  search.Load(order);
+  search.QueueAll();
+  double cost = search.Optimize();
+  TsmResult tour = search.GetTour(order.front());
+  ASSERT_EQ(tour.vertices.front(), order.front());
+  ASSERT_DOUBLE_EQ(TourLength(graph, tour), cost);
+
+  RandomStream gen(5);
+  for (size_t i = 0; i < 50; ++i) {
+    search.Kick(gen, 30);
+    cost = search.Optimize();
+    ASSERT_DOUBLE_EQ(TourLength(graph, search.GetTour(0)), cost);
+  }
+}
+
+TEST(LinKernighan, Seed) {
+  Graph graph = EuclideanGraph(200, 6);
+  LinKernighanParams params;
+  params.kicks = 100;
+  params.seed = 4;
+  TsmResult first = LinKernighan(graph, params).Solve();
+  TsmResult second = LinKernighan(graph, params).Solve();
+  ASSERT_EQ(first.vertices, second.vertices);
+  ASSERT_EQ(first.distance, second.distance);
+}
+
+TEST(LinKernighan, DirectedGraph) {
+  std::mt19937 gen(8);
+  std::uniform_int_distribution<size_t> weight(1, 100);
+  Graph graph(80);
+  for (size_t i = 0; i < graph.GetSize(); ++i) {
+    for (size_t j = 0; j < graph.GetSize(); ++j) {
+      if (i != j) graph.SetValue(i, j, weight(gen));
+    }
+  }
+  LinKernighanParams params;
+  params.kicks = 100;
+  TsmResult result = LinKernighan(graph, params).Solve();
+  ASSERT_DOUBLE_EQ(TourLength(graph, result), result.distance);
+}
+
+}  // namespace s21
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "common_tests.h"
+#include "model/s21_graph.h"
+#include "model/traveling_salesman/ant_colony_algorithm/ant_colony_solver.h"
+#include "model/traveling_salesman/common/local_search.h"
+
+namespace s21 {
+
+namespace {
+
+TsmResult RandomTour(const Graph &graph, unsigned seed) {
+  std::mt19937 gen(seed);
+  TsmResult tour;
+  tour.vertices.resize(graph.GetSize());
+  std::iota(tour.vertices.begin(), tour.vertices.end(), 0);
+  std::shuffle(tour.vertices.begin(), tour.vertices.end(), gen);
+  tour.vertices.push_back(tour.vertices.front());
+  tour.distance = 0;
+  for (size_t i = 0; i + 1 < tour.vertices.size(); ++i) {
+    size_t weight = graph.GetValue(tour.vertices[i], tour.vertices[i + 1]);
+    if (weight == 0) tour.distance = std::numeric_limits<double>::infinity();
+    tour.distance += weight;
+  }
+  return tour;
+}
+
+}  // namespace
+
+TEST(LocalSearch, ImprovesRandomTours) {
+  Graph graph = EuclideanGraph(300, 7);
+  LocalSearch local_search(graph);
+  for (unsigned seed : {1, 2, 3}) {
+    TsmResult tour = RandomTour(graph, seed);
+    double random_distance = tour.distance;
+    size_t start = tour.vertices.front();
+
+    ASSERT_TRUE(local_search.Improve(tour));
+    ASSERT_DOUBLE_EQ(TourLength(graph, tour), tour.distance);
+    ASSERT_EQ(tour.vertices.front(), start);
+    ASSERT_LT(tour.distance, random_distance / 4);
+    // Don't-look bits may skip a few moves, but not many.
+    double first_distance = tour.distance;
+    local_search.Improve(tour);
+    ASSERT_GT(tour.distance, first_distance * 0.99);
+  }
+}
+
+TEST(LocalSearch, SingleMoveKinds) {
+  Graph graph = EuclideanGraph(120, 11);
+  TsmResult random = RandomTour(graph, 5);
+
+  TsmResult two_opt = random;
+  LocalSearch only_two_opt(graph, LocalSearchParams{10, 3, true, false});
+  ASSERT_TRUE(only_two_opt.Improve(two_opt));
+  ASSERT_DOUBLE_EQ(TourLength(graph, two_opt), two_opt.distance);
+
+  TsmResult or_opt = random;
+  LocalSearch only_or_opt(graph, LocalSearchParams{10, 3, false, true});
+  ASSERT_TRUE(only_or_opt.Improve(or_opt));
+  ASSERT_DOUBLE_EQ(TourLength(graph, or_opt), or_opt.distance);
+
+  TsmResult both = random;
+  ASSERT_TRUE(LocalSearch(graph).Improve(both));
+  ASSERT_LE(both.distance, random.distance);
+}
+
+TEST(LocalSearch, DirectedGraph) {
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<size_t> weight(1, 100);
+  Graph graph(60);
+  for (size_t i = 0; i < graph.GetSize(); ++i) {
+    for (size_t j = 0; j < graph.GetSize(); ++j) {
+      if (i != j) graph.SetValue(i, j, weight(gen));
+    }
+  }
+  LocalSearch local_search(graph);
+  for (unsigned seed : {1, 2, 3, 4}) {
+    TsmResult tour = RandomTour(graph, seed);
+    double random_distance = tour.distance;
+    ASSERT_TRUE(local_search.Improve(tour));
+    ASSERT_DOUBLE_EQ(TourLength(graph, tour), tour.distance);
+    ASSERT_LT(tour.distance, random_distance);
+  }
+}
+
+TEST(LocalSearch, RepairsMissingArcs) {
+  Graph graph = EuclideanGraph(40, 13);
+  TsmResult tour = RandomTour(graph, 9);
+  // Take out two arcs of the tour in both directions.
+  for (size_t i : {3, 17}) {
+    graph.SetValue(tour.vertices[i], tour.vertices[i + 1], 0);
+    graph.SetValue(tour.vertices[i + 1], tour.vertices[i], 0);
+  }
+  tour.distance = std::numeric_limits<double>::infinity();
+
+  LocalSearch local_search(graph);
+  ASSERT_TRUE(local_search.Improve(tour));
+  ASSERT_TRUE(std::isfinite(tour.distance));
+  ASSERT_DOUBLE_EQ(TourLength(graph, tour), tour.distance);
+}
+
+TEST(LocalSearch, GraphExample) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  LocalSearch local_search(graph);
+  ASSERT_EQ(local_search.GetNeighbours(0).Size(), 10);
+
+  AntColonyParams params;
+  params.local_search = true;
+  AntColony ant_colony(graph, 1, 64, params);
+  TsmResult result = ant_colony.Solve();
+  ASSERT_DOUBLE_EQ(TourLength(graph, result), result.distance);
+  ASSERT_LT(result.distance, 270);
+}
+
+TEST(LocalSearch, RejectsBrokenTours) {
+  Graph graph = EuclideanGraph(6, 1);
+  LocalSearch local_search(graph);
+  TsmResult short_tour{{0, 1, 2, 0}, 0};
+  TsmResult repeated{{0, 1, 1, 3, 4, 5, 0}, 0};
+  TsmResult open{{0, 1, 2, 3, 4, 5, 1}, 0};
+  ASSERT_THROW(local_search.Improve(short_tour), std::invalid_argument);
+  ASSERT_THROW(local_search.Improve(repeated), std::invalid_argument);
+  ASSERT_THROW(local_search.Improve(open), std::invalid_argument);
+  ASSERT_THROW(local_search.GetNeighbours(6), std::out_of_range);
+}
+
+}  // namespace s21
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "common_tests.h"
+#include "libs/s21_random_stream.h"
+
+namespace s21 {
+
+namespace {
+
+std::vector<uint32_t> Draw(RandomStream stream, size_t count) {
+  std::vector<uint32_t> values(count);
+  for (uint32_t &value : values) value = stream();
+  return values;
+}
+
+}  // namespace
+
+TEST(RandomStream, MatchesPhiloxReference) {
+  // Philox4x32-10 known answers for a zero key and zero counter.
+  ASSERT_EQ(Draw(RandomStream(0, 0), 4),
+            std::vector<uint32_t>({0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                   0x9b00dbd8}));
+}
+
+TEST(RandomStream, StreamsAreReproducibleAndDistinct) {
+  ASSERT_EQ(Draw(RandomStream(7, 3), 100), Draw(RandomStream(7, 3), 100));
+
+  std::set<std::vector<uint32_t>> heads;
+  for (uint64_t seed : {0, 1, 7}) {
+    for (uint64_t stream : {0ull, 1ull, 2ull, 1ull << 40}) {
+      heads.insert(Draw(RandomStream(seed, stream), 8));
+    }
+  }
+  RandomStream parent(7, 3);
+  for (uint64_t index : {0, 1, 2}) {
+    heads.insert(Draw(parent.Split(index), 8));
+    heads.insert(Draw(parent.Split(index).Split(0), 8));
+  }
+  ASSERT_EQ(heads.size(), 3 * 4 + 3 * 2);
+}
+
+TEST(RandomStream, SplitIgnoresWhatWasDrawn) {
+  RandomStream fresh(5, 1);
+  RandomStream used(5, 1);
+  for (size_t i = 0; i < 10; ++i) used();
+  ASSERT_EQ(Draw(fresh.Split(4), 16), Draw(used.Split(4), 16));
+}
+
+TEST(RandomStream, WorksWithStandardDistributions) {
+  RandomStream stream(11);
+  std::uniform_int_distribution<int> die(1, 6);
+  std::vector<size_t> counts(7, 0);
+  const size_t rolls = 60000;
+  for (size_t i = 0; i < rolls; ++i) ++counts[die(stream)];
+  for (int face = 1; face <= 6; ++face) {
+    ASSERT_NEAR(counts[face], rolls / 6.0, rolls / 60.0);
+  }
+
+  std::vector<size_t> deck(52);
+  std::iota(deck.begin(), deck.end(), 0);
+  std::vector<size_t> first = deck;
+  std::vector<size_t> second = deck;
+  std::shuffle(first.begin(), first.end(), RandomStream(2));
+  std::shuffle(second.begin(), second.end(), RandomStream(2));
+  ASSERT_EQ(first, second);
+  ASSERT_NE(first, deck);
+}
+
+}  // namespace s21
@@ -1,5 +1,6 @@
 
 #include "common_tests.h"
+#include "model/s21_csr_graph.h"
 #include "model/s21_graph.h"
 #include "model/s21_graph_algorithms.h"
 
@@ -40,6 +41,19 @@ TEST_F(TestDepthFirstSearch, test4) {
   }
 }
 
+TEST(DepthFirstSearch, ContinuesScanInNewVertexRow) {
+  // On stepping from 1 to 3 the search goes on along the row of 3 past the
+  // column it came in on, so 4 comes before 2.
+  Graph graph(4);
+  graph.SetValue(0, 2, 1);
+  graph.SetValue(2, 1, 1);
+  graph.SetValue(2, 3, 1);
+  GraphAlgorithms algorithms;
+  std::vector<size_t> expected{0, 2, 3, 1};
+  ASSERT_EQ(algorithms.DepthFirstSearch(graph, 1), expected);
+  ASSERT_EQ(algorithms.DepthFirstSearch(CsrGraph(graph), 1), expected);
+}
+
 class TestBreadthFirstSearch : public ::testing::Test {
 protected:
   void SetUp() { graph.LoadGraphFromFile(kAssetsDir + "example2.txt"); }
@@ -108,6 +122,37 @@ TEST_F(TestGetShortestPathBetweenVertices, test3) {
   ASSERT_EQ(result, 11);
 }
 
+TEST_F(TestGetShortestPathBetweenVertices, test4Route) {
+  size_t vertex1 = 1;
+  size_t vertex2 = 8;
+  RouteResult result =
+      algorithms.GetShortestRouteBetweenVertices(graph, vertex1, vertex2);
+  ASSERT_EQ(result.distance, 11);
+  ASSERT_EQ(result.vertices.front(), vertex1 - 1);
+  ASSERT_EQ(result.vertices.back(), vertex2 - 1);
+
+  size_t length = 0;
+  for (size_t i = 0; i + 1 < result.vertices.size(); ++i) {
+    size_t weight = graph.GetValue(result.vertices[i], result.vertices[i + 1]);
+    ASSERT_NE(weight, 0);
+    length += weight;
+  }
+  ASSERT_EQ(length, result.distance);
+}
+
+TEST_F(TestGetShortestPathBetweenVertices, test5RouteToItself) {
+  RouteResult result = algorithms.GetShortestRouteBetweenVertices(graph, 4, 4);
+  ASSERT_EQ(result.distance, 0);
+  ASSERT_EQ(result.vertices, std::vector<size_t>{3});
+}
+
+TEST_F(TestGetShortestPathBetweenVertices, test6Throw) {
+  ASSERT_THROW(algorithms.GetShortestRouteBetweenVertices(graph, 0, 1),
+               std::invalid_argument);
+  ASSERT_THROW(algorithms.GetShortestRouteBetweenVertices(graph, 1, 10),
+               std::out_of_range);
+}
+
 class TestGetShortestPathsBetweenAllVertices : public ::testing::Test {
 protected:
   void SetUp() { graph.LoadGraphFromFile(kAssetsDir + "example3.txt"); }
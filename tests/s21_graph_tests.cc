@@ -10,7 +10,7 @@ TEST(Graph, ConstructorWithSize) {
 
   for (size_t i = 0; i < size; ++i) {
     for (size_t j = 0; j < size; ++j) {
-      size_t value = graph.GetData()[i][j];
+      size_t value = graph.GetValue(i, j);
       ASSERT_EQ(0, value);
     }
   }
@@ -23,7 +23,7 @@ TEST(Graph, ConstructorInitValue) {
 
   for (size_t i = 0; i < size; ++i) {
     for (size_t j = 0; j < size; ++j) {
-      size_t value = graph.GetData()[i][j];
+      size_t value = graph.GetValue(i, j);
       ASSERT_EQ(init_value, value);
     }
   }
@@ -41,7 +41,7 @@ TEST(Graph, SetValueThrow) {
   graph.SetValue(row, col, value);
   for (size_t i = 0; i < size; ++i) {
     for (size_t j = 0; j < size; ++j) {
-      size_t graph_value = graph.GetData()[i][j];
+      size_t graph_value = graph.GetValue(i, j);
       if (i == row && j == col) {
         ASSERT_EQ(value, graph_value);
       } else {
@@ -79,6 +79,34 @@ TEST(Graph, NeighborsThrow) {
   }
 }
 
+TEST(Graph, RowSpans) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "example3.txt");
+  ASSERT_THROW(graph.GetRow(9), std::out_of_range);
+
+  Graph::Row flat = graph.GetFlatData();
+  ASSERT_EQ(flat.Size(), graph.GetSize() * graph.GetSize());
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(flat.Data()) % kCacheLineSize, 0);
+  for (size_t i = 0; i < graph.GetSize(); ++i) {
+    Graph::Row row = graph.GetRow(i);
+    ASSERT_EQ(row.Size(), graph.GetSize());
+    for (size_t j = 0; j < graph.GetSize(); ++j) {
+      ASSERT_EQ(row[j], graph.GetValue(i, j));
+      ASSERT_EQ(flat[i * graph.GetSize() + j], graph.GetValue(i, j));
+    }
+  }
+}
+
+TEST(Graph, ConstructorFromMatrix) {
+  Graph::MatrixAdjacency matrix{{0, 2, 3}, {2, 0, 4}, {3, 4, 0}};
+  Graph graph(matrix);
+  ASSERT_EQ(graph.GetSize(), 3);
+  ASSERT_EQ(graph.GetData(), matrix);
+
+  matrix.back().pop_back();
+  ASSERT_THROW(Graph{matrix}, std::length_error);
+}
+
 TEST(Graph, LoadFromFileThrow) {
   Graph graph;
   ASSERT_THROW(graph.LoadGraphFromFile(kAssetsDir + "file_not_exists"),
@@ -1,6 +1,13 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 #include "common_tests.h"
 #include "model/s21_graph.h"
 #include "model/s21_graph_algorithms.h"
+#include "model/traveling_salesman/simulated_annealing/annealing_tour.h"
+#include "model/traveling_salesman/simulated_annealing/cooling_schedule.h"
+#include "model/traveling_salesman/simulated_annealing/simulated_annealing.h"
 
 namespace s21 {
 
@@ -48,4 +55,221 @@ TEST(SimulatedAnnealing, NoSolutionGraph) {
   ASSERT_EQ(std::numeric_limits<double>::infinity(), result.distance);
 }
 
-}  // namespace s21
\ No newline at end of file
+TEST(SimulatedAnnealing, MoveDeltas) {
+  for (bool symmetric : {true, false}) {
+    Graph graph = RandomGraph(12, 1, symmetric, 3);
+    AnnealingTour tour(graph);
+    std::vector<size_t> path(graph.GetSize());
+    std::iota(path.begin(), path.end(), 0);
+    path.push_back(0);
+    tour.Assign(path);
+
+    std::mt19937 gen(4);
+    std::uniform_int_distribution<size_t> position(1, graph.GetSize() - 1);
+    for (size_t i = 0; i < 3000; ++i) {
+      size_t first = position(gen);
+      size_t second = position(gen);
+      if (first == second) continue;
+      if (first > second) std::swap(first, second);
+      double before = tour.GetCost();
+      double delta = 0;
+      if (i % 3 == 0) {
+        delta = tour.SwapDelta(first, second);
+        tour.Swap(first, second);
+      } else if (i % 3 == 1) {
+        delta = tour.ReverseDelta(first, second);
+        tour.Reverse(first, second);
+      } else {
+        size_t length = std::min<size_t>(1 + i % 4, second - first);
+        delta = tour.MoveDelta(first, length, second);
+        tour.Move(first, length, second);
+      }
+      double distance = tour.GetDistance(tour.GetVertices());
+      ASSERT_DOUBLE_EQ(tour.GetCost(), distance) << i;
+      ASSERT_DOUBLE_EQ(before + delta, distance) << i;
+    }
+    std::vector<size_t> sorted = tour.GetVertices();
+    ASSERT_EQ(sorted.front(), 0);
+    ASSERT_EQ(sorted.back(), 0);
+    sorted.pop_back();
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); ++i) ASSERT_EQ(sorted[i], i);
+  }
+}
+
+TEST(SimulatedAnnealing, MoveBackwards) {
+  Graph graph = RandomGraph(8, 1, false, 5);
+  AnnealingTour tour(graph);
+  tour.Assign({0, 1, 2, 3, 4, 5, 6, 7, 0});
+  double delta = tour.MoveDelta(5, 2, 1);
+  double before = tour.GetCost();
+  tour.Move(5, 2, 1);
+  ASSERT_EQ(tour.GetVertices(),
+            std::vector<size_t>({0, 1, 5, 6, 2, 3, 4, 7, 0}));
+  ASSERT_DOUBLE_EQ(tour.GetCost(), before + delta);
+  ASSERT_DOUBLE_EQ(tour.GetCost(), tour.GetDistance(tour.GetVertices()));
+  ASSERT_THROW(tour.Assign({0, 1, 2}), std::invalid_argument);
+}
+
+TEST(SimulatedAnnealing, RandomGraphTour) {
+  Graph graph = RandomGraph(60, 1, true, 9);
+  GraphAlgorithms algorithms;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemSimulatedAnnealing(graph);
+
+  ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+  double distance = 0;
+  for (size_t i = 0; i + 1 < result.vertices.size(); ++i) {
+    distance += graph.GetValue(result.vertices[i], result.vertices[i + 1]);
+  }
+  ASSERT_DOUBLE_EQ(result.distance, distance);
+}
+
+TEST(SimulatedAnnealing, SeedIgnoresThreadCount) {
+  Graph graph = RandomGraph(40, 1, false, 6);
+  GraphAlgorithms algorithms;
+  for (AnnealingMode mode :
+       {AnnealingMode::kMultiStart, AnnealingMode::kReplicaExchange}) {
+    AnnealingParams params;
+    params.mode = mode;
+    params.seed = 17;
+    params.exchange_rounds = 100;
+    params.thread_count = 1;
+    TsmResult single =
+        algorithms.SolveTravelingSalesmanProblemSimulatedAnnealing(graph,
+                                                                   params);
+    params.thread_count = 3;
+    TsmResult several =
+        algorithms.SolveTravelingSalesmanProblemSimulatedAnnealing(graph,
+                                                                   params);
+    ASSERT_EQ(single.vertices, several.vertices);
+    ASSERT_EQ(single.distance, several.distance);
+  }
+}
+
+TEST(SimulatedAnnealing, ReplicaExchange) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  GraphAlgorithms algorithms;
+  AnnealingParams params;
+  params.mode = AnnealingMode::kReplicaExchange;
+  TsmResult result =
+      algorithms.SolveTravelingSalesmanProblemSimulatedAnnealing(graph, params);
+
+  ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+  ASSERT_LT(result.distance, 260);
+
+  Graph random = RandomGraph(100, 1, true, 12);
+  params.seed = 1;
+  TsmResult tempered =
+      algorithms.SolveTravelingSalesmanProblemSimulatedAnnealing(random,
+                                                                 params);
+  params.mode = AnnealingMode::kMultiStart;
+  TsmResult restarted =
+      algorithms.SolveTravelingSalesmanProblemSimulatedAnnealing(random,
+                                                                 params);
+  ASSERT_DOUBLE_EQ(TourLength(random, tempered), tempered.distance);
+  ASSERT_DOUBLE_EQ(TourLength(random, restarted), restarted.distance);
+  // Tempering stays within a bounded gap of what a long Lin-Kernighan run
+  // finds on this random-weight graph.
+  LinKernighanParams reference_params;
+  reference_params.kicks = 1000;
+  reference_params.seed = 1;
+  const double reference =
+      algorithms
+          .SolveTravelingSalesmanProblemLinKernighan(random, reference_params)
+          .distance;
+  ASSERT_LT(tempered.distance, 1.75 * reference) << reference;
+}
+
+TEST(SimulatedAnnealing, CoolingSchedules) {
+  AnnealingParams params;
+  params.schedule_length = 1000;
+  for (CoolingScheduleType type :
+       {CoolingScheduleType::kExponential, CoolingScheduleType::kLinear,
+        CoolingScheduleType::kAdaptive}) {
+    params.schedule = type;
+    CoolingSchedule cooling(params);
+    size_t steps = 0;
+    double last = cooling.GetTemperature();
+    while (!cooling.IsFrozen()) {
+      cooling.Step(steps % 4 == 0);
+      ++steps;
+      if (type != CoolingScheduleType::kAdaptive) {
+        ASSERT_LT(cooling.GetTemperature(), last);
+      }
+      last = cooling.GetTemperature();
+    }
+    ASSERT_LE(steps, params.schedule_length);
+    if (type != CoolingScheduleType::kAdaptive) {
+      ASSERT_EQ(steps, params.schedule_length);
+      ASSERT_NEAR(last, params.min_temperature, 1e-9);
+    }
+  }
+
+  params.schedule = CoolingScheduleType::kCustom;
+  CoolingSchedule custom(params);
+  custom.Step(true);
+  ASSERT_DOUBLE_EQ(custom.GetTemperature(),
+                   params.start_temperature / std::log10(2));
+}
+
+TEST(SimulatedAnnealing, Limits) {
+  Graph graph = RandomGraph(50, 1, true, 2);
+  AnnealingParams params;
+  params.algorithm_reloads = 10;
+  params.schedule_length = 2000;
+  params.thread_count = 2;
+  SimulatedAnnealing full(graph, params);
+  full.Solve();
+  ASSERT_EQ(full.GetStats().runs, 10);
+  ASSERT_EQ(full.GetStats().iterations, 10 * 2000);
+  ASSERT_GT(full.GetStats().accepted, 0);
+  ASSERT_LT(full.GetStats().accepted, full.GetStats().iterations);
+
+  params.max_iterations = 500;
+  SimulatedAnnealing capped(graph, params);
+  capped.Solve();
+  ASSERT_EQ(capped.GetStats().iterations, 10 * 500);
+
+  params.max_iterations = 0;
+  params.schedule = CoolingScheduleType::kLinear;
+  params.min_temperature = 1e-6;
+  params.stagnation_limit = 100;
+  SimulatedAnnealing stagnant(graph, params);
+  stagnant.Solve();
+  ASSERT_LT(stagnant.GetStats().iterations, 10 * 2000);
+
+  params.stagnation_limit = 0;
+  params.schedule_length = 1000000000;
+  params.time_limit = std::chrono::milliseconds(20);
+  SimulatedAnnealing timed(graph, params);
+  TsmResult result = timed.Solve();
+  ASSERT_TRUE(timed.GetStats().timed_out);
+  ASSERT_LT(timed.GetStats().elapsed.count(), 1.0);
+  ASSERT_EQ(result.vertices.size(), graph.GetSize() + 1);
+}
+
+TEST(SimulatedAnnealing, ReplicaExchangeLimits) {
+  Graph graph = RandomGraph(50, 1, true, 2);
+  AnnealingParams params;
+  params.mode = AnnealingMode::kReplicaExchange;
+  params.replica_count = 4;
+  params.seed = 3;
+  params.exchange_interval = 100;
+  params.exchange_rounds = 50;
+  SimulatedAnnealing full(graph, params);
+  full.Solve();
+  ASSERT_EQ(full.GetStats().runs, 4);
+  ASSERT_EQ(full.GetStats().iterations, 4 * 50 * 100);
+  // Rounds alternate between two pairs and one pair of levels.
+  ASSERT_EQ(full.GetStats().exchanges, 25 * 2 + 25);
+  ASSERT_GT(full.GetStats().accepted_exchanges, 0);
+
+  params.max_iterations = 250;
+  SimulatedAnnealing capped(graph, params);
+  capped.Solve();
+  ASSERT_EQ(capped.GetStats().iterations, 4 * 250);
+}
+
+}  // namespace s21
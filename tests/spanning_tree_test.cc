@@ -1,9 +1,50 @@
+#include <random>
+#include <thread>
+
 #include "common_tests.h"
+#include "libs/s21_concurrent_disjoint_set.h"
+#include "libs/s21_disjoint_set.h"
+#include "model/s21_csr_graph.h"
 #include "model/s21_graph.h"
 #include "model/s21_graph_algorithms.h"
 
 namespace s21 {
 
+namespace {
+
+// Drops one direction of some edges and gives others a different weight
+// each way.
+Graph Asymmetric(Graph graph, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> choice(0, 3);
+  std::uniform_int_distribution<size_t> weight(1, 50);
+  for (size_t i = 0; i < graph.GetSize(); ++i) {
+    for (size_t j = i + 1; j < graph.GetSize(); ++j) {
+      if (graph.GetValue(i, j) == 0) continue;
+      switch (choice(gen)) {
+        case 0:
+          graph.SetValue(i, j, 0);
+          break;
+        case 1:
+          graph.SetValue(j, i, 0);
+          break;
+        case 2:
+          graph.SetValue(j, i, weight(gen));
+          break;
+      }
+    }
+  }
+  return graph;
+}
+
+size_t TotalWeight(const std::vector<Edge> &edges) {
+  size_t total = 0;
+  for (const Edge &edge : edges) total += edge.weight;
+  return total;
+}
+
+}  // namespace
+
 TEST(SpanningTree, SingleVertexGraph) {
   Graph graph;
   graph.LoadGraphFromFile(kAssetsDir + "graph_1x1.txt");
@@ -48,4 +89,146 @@ TEST(SpanningTree, LargeGraph) {
   ASSERT_EQ(size, 150);
 }
 
-}  // namespace s21
\ No newline at end of file
+TEST(SpanningTree, PrimAndKruskalAgree) {
+  GraphAlgorithms algorithms;
+  for (double density : {0.02, 0.2, 1.0}) {
+    Graph symmetric = RandomGraph(120, density, true, 11);
+    for (const Graph &graph : {symmetric, Asymmetric(symmetric, 13)}) {
+      CsrGraph csr(graph);
+      std::vector<Edge> prim = algorithms.GetLeastSpanningTreeEdges(
+          graph, SpanningTreeAlgorithm::kPrim);
+      std::vector<Edge> kruskal = algorithms.GetLeastSpanningTreeEdges(
+          graph, SpanningTreeAlgorithm::kKruskal);
+      ASSERT_EQ(prim.size(), kruskal.size()) << density;
+      ASSERT_EQ(TotalWeight(kruskal), TotalWeight(prim)) << density;
+      ASSERT_EQ(TotalWeight(algorithms.GetLeastSpanningTreeEdges(
+                    csr, SpanningTreeAlgorithm::kPrim)),
+                TotalWeight(prim));
+      ASSERT_EQ(TotalWeight(algorithms.GetLeastSpanningTreeEdges(csr)),
+                TotalWeight(prim));
+    }
+  }
+}
+
+TEST(SpanningTree, BoruvkaMatchesSequential) {
+  for (double density : {0.01, 0.1, 1.0}) {
+    Graph graph = RandomGraph(300, density, true, 5);
+    CsrGraph csr(graph);
+    size_t expected = TotalWeight(
+        MinimumSpanningTree(SpanningTreeAlgorithm::kKruskal).Solve(graph));
+    std::vector<Edge> single =
+        MinimumSpanningTree(SpanningTreeAlgorithm::kBoruvka, 1).Solve(csr);
+    ASSERT_EQ(TotalWeight(single), expected) << density;
+    for (size_t threads : {2, 4, 7}) {
+      MinimumSpanningTree boruvka(SpanningTreeAlgorithm::kBoruvka, threads);
+      std::vector<Edge> dense = boruvka.Solve(graph);
+      std::vector<Edge> sparse = boruvka.Solve(csr);
+      ASSERT_EQ(dense.size(), single.size());
+      ASSERT_EQ(sparse.size(), single.size());
+      for (size_t i = 0; i < single.size(); ++i) {
+        ASSERT_EQ(dense[i].from, single[i].from);
+        ASSERT_EQ(dense[i].to, single[i].to);
+        ASSERT_EQ(sparse[i].weight, single[i].weight);
+      }
+    }
+  }
+}
+
+TEST(SpanningTree, BoruvkaEqualWeights) {
+  // A complete graph with a single weight: every tie has to be broken the
+  // same way or the chosen edges close cycles.
+  Graph graph = RandomGraph(64, 1.0, true, 3);
+  for (size_t i = 0; i < graph.GetSize(); ++i) {
+    for (size_t j = 0; j < graph.GetSize(); ++j) {
+      if (i != j) graph.SetValue(i, j, 1);
+    }
+  }
+  std::vector<Edge> edges =
+      MinimumSpanningTree(SpanningTreeAlgorithm::kBoruvka, 4).Solve(graph);
+  ASSERT_EQ(edges.size(), graph.GetSize() - 1);
+  DisjointSet components(graph.GetSize());
+  for (const Edge &edge : edges) {
+    ASSERT_TRUE(components.Union(edge.from, edge.to));
+  }
+}
+
+TEST(SpanningTree, EdgesFormSpanningTree) {
+  Graph graph;
+  graph.LoadGraphFromFile(kAssetsDir + "graph_example.txt");
+  GraphAlgorithms algorithms;
+
+  for (SpanningTreeAlgorithm algorithm :
+       {SpanningTreeAlgorithm::kPrim, SpanningTreeAlgorithm::kKruskal,
+        SpanningTreeAlgorithm::kBoruvka}) {
+    std::vector<Edge> edges =
+        algorithms.GetLeastSpanningTreeEdges(graph, algorithm);
+    ASSERT_EQ(edges.size(), graph.GetSize() - 1);
+    ASSERT_EQ(TotalWeight(edges), 150);
+    DisjointSet components(graph.GetSize());
+    for (const Edge &edge : edges) {
+      ASSERT_EQ(graph.GetValue(edge.from, edge.to), edge.weight);
+      ASSERT_TRUE(components.Union(edge.from, edge.to));
+    }
+    ASSERT_EQ(components.SetCount(), 1);
+  }
+}
+
+TEST(SpanningTree, DisconnectedGraphGivesForest) {
+  // Two components: {0, 1, 2} and {3, 4}.
+  CsrGraph graph(5, {{0, 1, 4}, {1, 0, 4}, {1, 2, 1}, {2, 1, 1},
+                     {0, 2, 2}, {2, 0, 2}, {3, 4, 7}, {4, 3, 7}});
+  GraphAlgorithms algorithms;
+
+  for (SpanningTreeAlgorithm algorithm :
+       {SpanningTreeAlgorithm::kPrim, SpanningTreeAlgorithm::kKruskal,
+        SpanningTreeAlgorithm::kBoruvka}) {
+    std::vector<Edge> edges =
+        algorithms.GetLeastSpanningTreeEdges(graph, algorithm);
+    ASSERT_EQ(edges.size(), 3);
+    ASSERT_EQ(TotalWeight(edges), 10);
+  }
+  std::vector<std::vector<size_t>> matrix =
+      algorithms.GetLeastSpanningTree(graph.ToGraph());
+  ASSERT_EQ(matrix[3][4], 7);
+  ASSERT_EQ(matrix[0][1], 0);
+}
+
+TEST(DisjointSet, UnionAndFind) {
+  DisjointSet sets(6);
+  ASSERT_EQ(sets.SetCount(), 6);
+  ASSERT_TRUE(sets.Union(0, 1));
+  ASSERT_TRUE(sets.Union(2, 3));
+  ASSERT_TRUE(sets.Union(1, 3));
+  ASSERT_FALSE(sets.Union(0, 2));
+  ASSERT_TRUE(sets.Connected(0, 3));
+  ASSERT_FALSE(sets.Connected(0, 4));
+  ASSERT_EQ(sets.SetCount(), 3);
+  ASSERT_THROW(sets.Find(6), std::out_of_range);
+  sets.Reset(2);
+  ASSERT_EQ(sets.Size(), 2);
+  ASSERT_FALSE(sets.Connected(0, 1));
+}
+
+TEST(ConcurrentDisjointSet, ParallelUnions) {
+  const size_t size = 10000;
+  ConcurrentDisjointSet sets(size);
+  std::vector<std::thread> threads;
+  // Every thread chains the same even and odd elements, in its own order.
+  for (size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&sets, t] {
+      for (size_t i = 0; i + 2 < size; ++i) {
+        size_t first = (i * (2 * t + 1)) % (size - 2);
+        sets.Union(first, first + 2);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(sets.Find(i), i % 2);
+  }
+  ASSERT_FALSE(sets.Connected(0, 1));
+  ASSERT_FALSE(sets.Union(2, 4));
+  ASSERT_THROW(sets.Find(size), std::out_of_range);
+}
+
+}  // namespace s21
@@ -0,0 +1,37 @@
+#include <atomic>
+
+#include "common_tests.h"
+#include "libs/s21_thread_pool.h"
+
+namespace s21 {
+
+TEST(ThreadPool, RunsEveryIndexOnce) {
+  for (size_t threads : {1, 2, 4}) {
+    ThreadPool pool(threads);
+    ASSERT_EQ(pool.GetThreadCount(), threads);
+    for (size_t count : {0, 1, 3, 1000}) {
+      std::vector<std::atomic<int>> hits(count);
+      pool.ParallelFor(count, [&hits](size_t i) { ++hits[i]; });
+      for (auto &hit : hits) ASSERT_EQ(hit.load(), 1);
+    }
+  }
+}
+
+TEST(ThreadPool, DefaultsToHardwareThreads) {
+  ThreadPool pool;
+  ASSERT_GE(pool.GetThreadCount(), 1);
+}
+
+TEST(ThreadPool, RethrowsTaskException) {
+  ThreadPool pool(3);
+  ASSERT_THROW(pool.ParallelFor(100,
+                                [](size_t i) {
+                                  if (i == 42) throw std::runtime_error("42");
+                                }),
+               std::runtime_error);
+  std::atomic<size_t> sum{0};
+  pool.ParallelFor(10, [&sum](size_t i) { sum += i; });
+  ASSERT_EQ(sum.load(), 45);
+}
+
+}  // namespace s21